@@ -102,6 +102,7 @@ public:
         try {
             auto task = [this, msg = std::move(msg), sender, self = this->shared_from_this()]() mutable {
                 try {
+                    ReloadIfPassivated();
                     OnMessageReceived(std::move(msg), sender);
                     if (auto_persist_) {
                         PersistState();
@@ -132,6 +133,7 @@ public:
 
         auto task = [this, msg = std::move(msg), sender, promise, self = this->shared_from_this()]() mutable {
             try {
+                ReloadIfPassivated();
                 if constexpr (std::is_same_v<T, ResultType>) {
                     auto result = OnMessageReceivedWithResult(std::move(msg), sender);
                     promise->set_value(std::move(result));
@@ -199,6 +201,16 @@ protected:
         }
     }
 
+    // The store passivates idle actors; bring the state back into memory and
+    // reload it before the next message is handled
+    void ReloadIfPassivated() {
+        if (store_ && store_->reactivate(actor_id_)) {
+            if (!LoadStateFromStore()) {
+                InitializeDefaultState();
+            }
+        }
+    }
+
     // Message processing
     virtual void StartMessageProcessing() {
         is_processing_ = true;
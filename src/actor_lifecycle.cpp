@@ -2,11 +2,11 @@
 #include<algorithm>
 #include<regex>
 
-ActorLifecycle::ActorLifecycle(std::shared_ptr<MemStore> store)
+ActorLifecycle::ActorLifecycle(std::shared_ptr<IStore> store)
     : store_(store) {}
 
 ActorLifecycle::~ActorLifecycle() {
-    // Cleanup if needed
+    StopPassivation();
 }
 
 bool ActorLifecycle::ValidateActorId(const std::string& actor_id) const {
@@ -23,8 +23,8 @@ bool ActorLifecycle::SpawnActor(const std::string& actor_id,
     
     std::lock_guard<std::mutex> lock(mutex_);
     
-    // Check if actor already exists
-    if (ActorExists(actor_id)) {
+    // Check if actor already exists (mutex_ is held, so not via ActorExists)
+    if (active_actors_.count(actor_id)) {
         return false;
     }
     
@@ -66,7 +66,7 @@ bool ActorLifecycle::TerminateActor(const std::string& actor_id, bool force) {
         // Optionally: Clear actor state (if not force, might want to preserve)
         if (force && store_) {
             // Clear all keys for this actor
-            // This would require additional methods in MemStore
+            // This would require additional methods in IStore
         }
         
         // Mark actor as inactive
@@ -88,7 +88,49 @@ bool ActorLifecycle::ActorExists(const std::string& actor_id) const {
 
 bool ActorLifecycle::IsActorActive(const std::string& actor_id) const {
     std::lock_guard<std::mutex> lock(mutex_);
-    return active_actors_.find(actor_id) != active_actors_.end();   
+    return active_actors_.find(actor_id) != active_actors_.end();
+}
+
+bool ActorLifecycle::IsActorResident(const std::string& actor_id) const {
+    return IsActorActive(actor_id) && !(store_ && store_->is_passivated(actor_id));
+}
+
+std::vector<std::string> ActorLifecycle::PassivateIdleActors(std::chrono::milliseconds idle_after) {
+    if (!store_) {
+        return {};
+    }
+    return store_->passivate_idle(idle_after);
+}
+
+void ActorLifecycle::StartPassivation(std::chrono::milliseconds idle_after, std::chrono::milliseconds interval) {
+    StopPassivation();
+    {
+        std::lock_guard<std::mutex> lock(passivation_mutex_);
+        stop_passivation_ = false;
+    }
+    passivation_thread_ = std::thread([this, idle_after, interval]() {
+        std::unique_lock<std::mutex> lock(passivation_mutex_);
+        while (!passivation_cv_.wait_for(lock, interval, [this] { return stop_passivation_; })) {
+            lock.unlock();
+            try {
+                PassivateIdleActors(idle_after);
+            } catch (const std::exception& e) {
+                std::cerr << "[ActorLifecycle] Passivation failed: " << e.what() << std::endl;
+            }
+            lock.lock();
+        }
+    });
+}
+
+void ActorLifecycle::StopPassivation() {
+    {
+        std::lock_guard<std::mutex> lock(passivation_mutex_);
+        stop_passivation_ = true;
+    }
+    passivation_cv_.notify_all();
+    if (passivation_thread_.joinable()) {
+        passivation_thread_.join();
+    }
 }
 
 void ActorLifecycle::RegisterPreSpawnHook(LifecycleCallback hook) {
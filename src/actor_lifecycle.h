@@ -2,27 +2,41 @@
 #include <string>
 #include <iostream>
 #include <unordered_set>
+#include <unordered_map>
 #include<vector>
 #include<memory>
 #include<mutex>
 #include<functional>
-#include "mem_store.h" 
+#include<thread>
+#include<chrono>
+#include<condition_variable>
+#include "store.h"
 
 class ActorLifecycle {
 public:
     using LifecycleCallback = std::function<void(const std::string& actor_id)>;
     
-    ActorLifecycle(std::shared_ptr<MemStore> store);
+    ActorLifecycle(std::shared_ptr<IStore> store);
     ~ActorLifecycle();
 
     // Lifecycle operations
     bool SpawnActor(const std::string& actor_id, 
-                   const unordered_map<std::string, std::string>& initial_state = {});
+                   const std::unordered_map<std::string, std::string>& initial_state = {});
     bool TerminateActor(const std::string& actor_id, bool force = false);
 
     // Check actor status
     bool ActorExists(const std::string& actor_id) const;
+    // True between spawn and terminate, whether or not the state is in memory
     bool IsActorActive(const std::string& actor_id) const;
+    // Active and held in memory, i.e. not passivated to disk
+    bool IsActorResident(const std::string& actor_id) const;
+
+    // Passivation: writes the state of actors idle for idle_after out of the
+    // store's memory. It comes back on the next get, set or message.
+    std::vector<std::string> PassivateIdleActors(std::chrono::milliseconds idle_after);
+    // Runs PassivateIdleActors every interval until StopPassivation().
+    void StartPassivation(std::chrono::milliseconds idle_after, std::chrono::milliseconds interval);
+    void StopPassivation();
     
     // Lifecycle hooks
     void RegisterPreSpawnHook(LifecycleCallback hook);
@@ -34,12 +48,12 @@ public:
     size_t GetActiveActorCount() const;
     std::vector<std::string> GetActiveActors() const;
 
-    std::shared_ptr<MemStore> GetStore() const {
+    std::shared_ptr<IStore> GetStore() const {
         return store_;
     }
 
 private:
-    std::shared_ptr<MemStore> store_;
+    std::shared_ptr<IStore> store_;
     mutable std::mutex mutex_;
     std::unordered_set<std::string> active_actors_;
 
@@ -48,6 +62,11 @@ private:
     LifecycleCallback post_spawn_hook_;
     LifecycleCallback pre_terminate_hook_;
     LifecycleCallback post_terminate_hook_;
+
+    std::thread passivation_thread_;
+    std::mutex passivation_mutex_;
+    std::condition_variable passivation_cv_;
+    bool stop_passivation_ = false;
     
     void ExecuteHookSafely(LifecycleCallback& hook, const std::string& actor_id);
     bool ValidateActorId(const std::string& actor_id) const;
@@ -0,0 +1,279 @@
+#include "checkpoint_manager.h"
+#include "snapshot.h"
+#include "utils/durable_file.h"
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace {
+constexpr const char* kManifest = "CHECKPOINT";
+
+// Owned copy of a record, since reader views die with the callback
+struct StoredRecord {
+    std::string key;
+    std::string value;
+    uint64_t version;
+    uint64_t created_at_ms;
+    uint64_t expires_at_ms;
+};
+
+uint64_t id_of(const std::string& name) {
+    auto dash = name.find('-');
+    auto dot = name.find('.', dash);
+    if (dash == std::string::npos || dot == std::string::npos) return 0;
+    try {
+        return std::stoull(name.substr(dash + 1, dot - dash - 1));
+    } catch (const std::exception&) {
+        return 0;
+    }
+}
+}
+
+CheckpointManager::CheckpointManager(std::shared_ptr<MemStore> store, std::shared_ptr<ThreadPool<>> pool,
+                                     std::string dir, size_t merge_after_deltas)
+    : store_(std::move(store)), pool_(std::move(pool)), dir_(std::move(dir)),
+      merge_after_deltas_(std::max<size_t>(merge_after_deltas, 1)) {
+    std::filesystem::create_directories(dir_);
+    load_manifest();
+}
+
+CheckpointManager::~CheckpointManager() {
+    stop();
+}
+
+void CheckpointManager::start(std::chrono::milliseconds interval) {
+    {
+        std::lock_guard lock(timer_mutex_);
+        if (timer_.joinable()) return;
+        stopping_ = false;
+    }
+    timer_ = std::thread([this, interval]() {
+        std::unique_lock lock(timer_mutex_);
+        while (!timer_cv_.wait_for(lock, interval, [this] { return stopping_; })) {
+            lock.unlock();
+            try {
+                bool has_base;
+                {
+                    std::lock_guard state(mutex_);
+                    has_base = !base_.empty();
+                }
+                if (!has_base || store_->dirty_actor_count() > 0) {
+                    checkpoint();
+                }
+            } catch (const std::exception& ex) {
+                std::cerr << "[CheckpointManager] Checkpoint failed: " << ex.what() << "\n";
+            }
+            lock.lock();
+        }
+    });
+}
+
+void CheckpointManager::stop() {
+    {
+        std::lock_guard lock(timer_mutex_);
+        stopping_ = true;
+    }
+    timer_cv_.notify_all();
+    if (timer_.joinable()) {
+        timer_.join();
+    }
+}
+
+uint64_t CheckpointManager::checkpoint(bool full) {
+    std::lock_guard serial(checkpoint_mutex_);
+    std::string name;
+    bool delta;
+    {
+        std::lock_guard lock(mutex_);
+        delta = !full && !base_.empty();
+        name = (delta ? "delta-" : "base-") + std::to_string(next_id_++) + ".ckpt";
+    }
+
+    const uint64_t wal_seq = store_->write_checkpoint(path_of(name), delta);
+
+    size_t pending;
+    std::vector<std::string> superseded;
+    {
+        std::lock_guard lock(mutex_);
+        if (delta) {
+            deltas_.push_back(name);
+        } else {
+            if (!base_.empty()) superseded.push_back(base_);
+            superseded.insert(superseded.end(), deltas_.begin(), deltas_.end());
+            base_ = name;
+            deltas_.clear();
+        }
+        write_manifest();
+        pending = deltas_.size();
+    }
+    std::error_code ec;
+    for (const auto& old : superseded) {
+        std::filesystem::remove(path_of(old), ec);
+    }
+    (delta ? delta_checkpoints_ : full_checkpoints_)++;
+
+    if (pending >= merge_after_deltas_) {
+        schedule_merge();
+    }
+    return wal_seq;
+}
+
+void CheckpointManager::schedule_merge() {
+    if (!pool_) {
+        merge();
+        return;
+    }
+    if (merge_scheduled_.exchange(true)) {
+        return; // already queued
+    }
+    std::weak_ptr<CheckpointManager> weak = weak_from_this();
+    pool_->SubmitBackground([weak]() {
+        if (auto self = weak.lock()) {
+            self->merge_scheduled_ = false;
+            try {
+                self->merge();
+            } catch (const std::exception& ex) {
+                std::cerr << "[CheckpointManager] Merge failed: " << ex.what() << "\n";
+            }
+        }
+    });
+}
+
+bool CheckpointManager::merge() {
+    std::lock_guard serial(merge_mutex_);
+    std::string base;
+    std::vector<std::string> deltas;
+    uint64_t id;
+    {
+        std::lock_guard lock(mutex_);
+        if (base_.empty() || deltas_.empty()) return false;
+        base = base_;
+        deltas = deltas_;
+        id = next_id_++;
+    }
+
+    // Latest full state of every actor the deltas touch; an empty list means removed
+    std::unordered_map<std::string, std::vector<StoredRecord>> changed;
+    uint64_t wal_seq = 0;
+    for (const auto& delta : deltas) {
+        SnapshotReader reader(path_of(delta));
+        std::unordered_set<std::string> seen;
+        reader.for_each([&](const SnapshotRecord& record) {
+            std::string actor_id(record.actor_id);
+            auto& records = changed[actor_id];
+            if (seen.insert(actor_id).second) {
+                records.clear(); // a later delta supersedes the actor entirely
+            }
+            if (!record.actor_removed) {
+                records.push_back(StoredRecord{std::string(record.key), std::string(record.value),
+                                               record.version, record.created_at_ms,
+                                               record.expires_at_ms});
+            }
+        });
+        wal_seq = reader.wal_seq();
+    }
+
+    const std::string name = "base-" + std::to_string(id) + ".ckpt";
+    SnapshotWriter writer(path_of(name), wal_seq);
+    SnapshotReader(path_of(base)).for_each([&](const SnapshotRecord& record) {
+        if (!changed.count(std::string(record.actor_id))) {
+            writer.add(record);
+        }
+    });
+    for (const auto& [actor_id, records] : changed) {
+        for (const auto& stored : records) {
+            SnapshotRecord record;
+            record.actor_id = actor_id;
+            record.key = stored.key;
+            record.value = stored.value;
+            record.version = stored.version;
+            record.created_at_ms = stored.created_at_ms;
+            record.expires_at_ms = stored.expires_at_ms;
+            writer.add(record);
+        }
+    }
+    writer.finish();
+
+    {
+        // Deltas written while we were merging stay on top of the new base
+        std::lock_guard lock(mutex_);
+        if (base_ != base) {
+            // A full checkpoint replaced the chain underneath us
+            std::error_code ec;
+            std::filesystem::remove(path_of(name), ec);
+            return false;
+        }
+        base_ = name;
+        deltas_.erase(deltas_.begin(), deltas_.begin() + deltas.size());
+        write_manifest();
+    }
+
+    std::error_code ec;
+    std::filesystem::remove(path_of(base), ec);
+    for (const auto& delta : deltas) {
+        std::filesystem::remove(path_of(delta), ec);
+    }
+    merges_++;
+    return true;
+}
+
+bool CheckpointManager::recover() {
+    std::string base;
+    std::vector<std::string> deltas;
+    {
+        std::lock_guard lock(mutex_);
+        if (base_.empty()) return false;
+        base = path_of(base_);
+        for (const auto& delta : deltas_) {
+            deltas.push_back(path_of(delta));
+        }
+    }
+    store_->recover_from_checkpoint(base, deltas);
+    return true;
+}
+
+size_t CheckpointManager::delta_count() const {
+    std::lock_guard lock(mutex_);
+    return deltas_.size();
+}
+
+CheckpointManager::Stats CheckpointManager::stats() const {
+    return Stats{full_checkpoints_.load(), delta_checkpoints_.load(), merges_.load()};
+}
+
+std::string CheckpointManager::path_of(const std::string& name) const {
+    return (std::filesystem::path(dir_) / name).string();
+}
+
+void CheckpointManager::load_manifest() {
+    std::ifstream in(path_of(kManifest));
+    std::string line;
+    while (getline(in, line)) {
+        std::istringstream fields(line);
+        std::string kind, name;
+        if (!(fields >> kind >> name)) continue;
+        if (kind == "base") {
+            base_ = name;
+        } else if (kind == "delta") {
+            deltas_.push_back(name);
+        } else {
+            continue;
+        }
+        next_id_ = std::max(next_id_, id_of(name) + 1);
+    }
+}
+
+void CheckpointManager::write_manifest() {
+    // Synced before returning, since callers delete the files it supersedes
+    std::ostringstream out;
+    if (!base_.empty()) {
+        out << "base " << base_ << "\n";
+    }
+    for (const auto& delta : deltas_) {
+        out << "delta " << delta << "\n";
+    }
+    durable_file::write_atomically(path_of(kManifest), out.str());
+}
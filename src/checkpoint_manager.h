@@ -0,0 +1,82 @@
+#pragma once
+#include <memory>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include "mem_store.h"
+#include "utils/thread_pool.h"
+
+// Incremental checkpoints for a MemStore. The first checkpoint is a full base;
+// after that each checkpoint is a delta holding only the actors changed since
+// the previous one. Once enough deltas pile up they are folded into a new base
+// on the pool's background lane.
+//
+// The checkpoint directory holds a CHECKPOINT manifest, rewritten atomically:
+//
+//   base base-<n>.ckpt
+//   delta delta-<n>.ckpt
+//   ...
+//
+// Must be owned by a shared_ptr: scheduled merges only hold a weak reference.
+class CheckpointManager : public std::enable_shared_from_this<CheckpointManager>
+{
+public:
+    struct Stats {
+        uint64_t full_checkpoints = 0;
+        uint64_t delta_checkpoints = 0;
+        uint64_t merges = 0;
+    };
+
+    CheckpointManager(std::shared_ptr<MemStore> store, std::shared_ptr<ThreadPool<>> pool,
+                      std::string dir = "checkpoints", size_t merge_after_deltas = 8);
+    ~CheckpointManager();
+
+    // Takes a checkpoint every interval until stop(); idle intervals are skipped.
+    void start(std::chrono::milliseconds interval);
+    void stop();
+
+    // Writes a full checkpoint if there is no base yet (or full is set), otherwise
+    // a delta. A full checkpoint starts a new chain and drops the old files.
+    // Returns the WAL seq_no the checkpoint covers.
+    uint64_t checkpoint(bool full = false);
+    // Folds the current deltas into a new base on the calling thread.
+    bool merge();
+    // Loads the base and deltas into the store and replays the WAL tail.
+    // Returns false if no checkpoint has been written yet.
+    bool recover();
+
+    size_t delta_count() const;
+    Stats stats() const;
+
+private:
+    std::shared_ptr<MemStore> store_;
+    std::shared_ptr<ThreadPool<>> pool_;
+    std::string dir_;
+    size_t merge_after_deltas_;
+
+    mutable std::mutex mutex_;       // guards base_, deltas_, next_id_ and the manifest
+    std::mutex checkpoint_mutex_;    // one checkpoint at a time keeps deltas in order
+    std::mutex merge_mutex_;
+    std::string base_;
+    std::vector<std::string> deltas_;
+    uint64_t next_id_ = 1;
+    std::atomic<bool> merge_scheduled_{false};
+
+    std::thread timer_;
+    std::mutex timer_mutex_;
+    std::condition_variable timer_cv_;
+    bool stopping_ = false;
+
+    std::atomic<uint64_t> full_checkpoints_{0};
+    std::atomic<uint64_t> delta_checkpoints_{0};
+    std::atomic<uint64_t> merges_{0};
+
+    std::string path_of(const std::string& name) const;
+    void load_manifest();
+    void write_manifest(); // caller holds mutex_
+    void schedule_merge();
+};
@@ -0,0 +1,845 @@
+#include "lsm_store.h"
+#include "snapshot.h"
+#include "wal_cursor.h"
+#include "utils/binary_io.h"
+#include "utils/durable_file.h"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <queue>
+#include <sstream>
+#include <unordered_set>
+
+namespace {
+uint64_t now_ms() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+// One sorted input of a merge: a table or a frozen memtable.
+class Source
+{
+public:
+    virtual ~Source() = default;
+    virtual bool valid() const = 0;
+    virtual std::string_view key() const = 0;
+    virtual std::string_view value() const = 0;
+    virtual void next() = 0;
+};
+
+class TableSource : public Source
+{
+public:
+    explicit TableSource(std::shared_ptr<const SSTReader> table) : it_(std::move(table)) {}
+    bool valid() const override { return it_.valid(); }
+    std::string_view key() const override { return it_.key(); }
+    std::string_view value() const override { return it_.value(); }
+    void next() override { it_.next(); }
+
+private:
+    SSTReader::Iterator it_;
+};
+
+template <typename Map>
+class MapSource : public Source
+{
+public:
+    explicit MapSource(std::shared_ptr<const Map> map) : map_(std::move(map)), it_(map_->begin()) {}
+    bool valid() const override { return it_ != map_->end(); }
+    std::string_view key() const override { return it_->first; }
+    std::string_view value() const override { return it_->second; }
+    void next() override { ++it_; }
+
+private:
+    std::shared_ptr<const Map> map_;
+    typename Map::const_iterator it_;
+};
+
+// Merges sources in key order. Sources earlier in the list are newer, and
+// only the newest value of each key is produced.
+class MergingIterator
+{
+public:
+    explicit MergingIterator(std::vector<std::unique_ptr<Source>> sources) : sources_(std::move(sources)) {
+        for (size_t i = 0; i < sources_.size(); ++i) {
+            if (sources_[i]->valid()) heap_.push(i);
+        }
+        advance();
+    }
+
+    bool valid() const { return valid_; }
+    const std::string& key() const { return key_; }
+    const std::string& value() const { return value_; }
+    void next() { advance(); }
+
+private:
+    struct Later {
+        const std::vector<std::unique_ptr<Source>>* sources;
+        bool operator()(size_t a, size_t b) const {
+            int cmp = (*sources)[a]->key().compare((*sources)[b]->key());
+            return cmp != 0 ? cmp > 0 : a > b;
+        }
+    };
+
+    std::vector<std::unique_ptr<Source>> sources_;
+    std::priority_queue<size_t, std::vector<size_t>, Later> heap_{Later{&sources_}};
+    std::string key_;
+    std::string value_;
+    bool valid_ = false;
+
+    void advance() {
+        valid_ = false;
+        if (heap_.empty()) return;
+        size_t top = heap_.top();
+        heap_.pop();
+        key_.assign(sources_[top]->key());
+        value_.assign(sources_[top]->value());
+        valid_ = true;
+        step(top);
+        // Older values of the same key sit in later sources
+        while (!heap_.empty() && sources_[heap_.top()]->key() == key_) {
+            size_t older = heap_.top();
+            heap_.pop();
+            step(older);
+        }
+    }
+
+    void step(size_t index) {
+        sources_[index]->next();
+        if (sources_[index]->valid()) heap_.push(index);
+    }
+};
+
+using EntryMap = std::map<std::string, std::string, std::less<>>;
+}
+
+void LSMStore::Record::encode(std::string& out) const {
+    binary_io::put_varint(out, deleted ? 1 : 0);
+    binary_io::put_varint(out, seq);
+    binary_io::put_varint(out, version);
+    binary_io::put_varint(out, created_at_ms);
+    binary_io::put_varint(out, expires_at_ms);
+    out.append(value);
+}
+
+bool LSMStore::Record::decode(std::string_view in) {
+    uint64_t flags;
+    if (!binary_io::get_varint(in, flags) || !binary_io::get_varint(in, seq) ||
+        !binary_io::get_varint(in, version) || !binary_io::get_varint(in, created_at_ms) ||
+        !binary_io::get_varint(in, expires_at_ms)) {
+        return false;
+    }
+    deleted = flags & 1;
+    value.assign(in.data(), in.size());
+    return true;
+}
+
+std::shared_ptr<LSMStore> LSMStore::Open(const std::string& dir, std::shared_ptr<WAL> wal,
+                                         std::shared_ptr<ThreadPool<>> thread_pool, Options options) {
+    auto store = std::make_shared<LSMStore>(dir, std::move(wal), std::move(thread_pool), options);
+    store->schedule_compaction(); // tables may have been left over their limits
+    return store;
+}
+
+LSMStore::LSMStore(const std::string& dir, std::shared_ptr<WAL> wal,
+                   std::shared_ptr<ThreadPool<>> thread_pool, Options options)
+    : dir_(dir), thread_pool_(std::move(thread_pool)), options_(options),
+      cache_(std::make_shared<BlockCache>(options.block_cache_bytes)),
+      events_([this](const EventSequencer::EventPtr& event) {
+                  subscription_system_.notify(event);
+                  change_feed_.publish(event);
+              },
+              [this](std::function<void()> drain) {
+                  if (thread_pool_) {
+                      thread_pool_->Submit(std::move(drain));
+                  } else {
+                      drain();
+                  }
+              }),
+      mem_(std::make_shared<Memtable>()) {
+    options_.num_levels = std::max<size_t>(options_.num_levels, 2);
+    std::filesystem::create_directories(dir_);
+    wal_ = wal ? std::move(wal) : std::make_shared<WAL>((std::filesystem::path(dir_) / "lsm.wal").string());
+    compact_pointer_.resize(options_.num_levels);
+    load_manifest();
+
+    std::lock_guard lock(write_mutex_);
+    replay_wal(flushed_seq_ + 1);
+}
+
+std::string LSMStore::internal_key(std::string_view actor_id, std::string_view key) {
+    std::string out;
+    out.reserve(actor_id.size() + key.size() + 2);
+    binary_io::put_bytes(out, actor_id);
+    out.append(key.data(), key.size());
+    return out;
+}
+
+bool LSMStore::split_key(std::string_view internal, std::string_view& actor_id, std::string_view& key) {
+    if (!binary_io::get_bytes(internal, actor_id)) return false;
+    key = internal;
+    return true;
+}
+
+bool LSMStore::set(const std::string& actor_id, const std::string& key, const std::string& value,
+                   std::optional<int> ttl_secs) {
+    uint64_t seq_no, ticket;
+    uint64_t version, expires_at_ms, created_at_ms;
+    {
+        std::lock_guard lock(write_mutex_);
+        std::string ikey = internal_key(actor_id, key);
+        auto current = lookup(ikey);
+
+        Record record;
+        record.version = (current && !current->deleted) ? current->version + 1 : 1;
+        record.created_at_ms = now_ms();
+        if (ttl_secs) {
+            record.expires_at_ms = record.created_at_ms + static_cast<uint64_t>(*ttl_secs) * 1000;
+        }
+        record.value = value;
+        record.seq = seq_no = wal_->reserve(actor_id);
+        ticket = events_.ticket(seq_no);
+        version = record.version;
+        expires_at_ms = record.expires_at_ms;
+        created_at_ms = record.created_at_ms;
+        apply(std::move(ikey), record);
+    }
+    log_reserved(ticket, seq_no, actor_id, key, value, WAL::Op::Put, version, expires_at_ms, created_at_ms);
+    notify_subscribers(ticket, actor_id, key, value, seq_no);
+    return true;
+}
+
+std::optional<std::string> LSMStore::get(const std::string& actor_id, const std::string& key) {
+    auto record = lookup(internal_key(actor_id, key));
+    if (!record || !record->live(now_ms())) {
+        return std::nullopt;
+    }
+    return std::move(record->value);
+}
+
+bool LSMStore::del(const std::string& actor_id, const std::string& key) {
+    uint64_t seq_no, ticket;
+    {
+        std::lock_guard lock(write_mutex_);
+        std::string ikey = internal_key(actor_id, key);
+        auto current = lookup(ikey);
+        if (!current || current->deleted) {
+            return false;
+        }
+        Record tombstone;
+        tombstone.deleted = true;
+        tombstone.created_at_ms = now_ms();
+        tombstone.seq = seq_no = wal_->reserve(actor_id);
+        ticket = events_.ticket(seq_no);
+        apply(std::move(ikey), tombstone);
+    }
+    log_reserved(ticket, seq_no, actor_id, key, "", WAL::Op::Delete);
+    notify_subscribers(ticket, actor_id, key, "", seq_no, true);
+    return true;
+}
+
+bool LSMStore::set_if_version(const std::string& actor_id, const std::string& key,
+                              const std::string& value, uint64_t expected_version) {
+    uint64_t seq_no, ticket;
+    uint64_t version, expires_at_ms, created_at_ms;
+    {
+        std::lock_guard lock(write_mutex_);
+        std::string ikey = internal_key(actor_id, key);
+        auto current = lookup(ikey);
+        uint64_t current_version = (current && !current->deleted) ? current->version : 0;
+        if (current_version != expected_version) {
+            return false;
+        }
+        Record record;
+        record.version = current_version + 1;
+        record.created_at_ms = (current && !current->deleted) ? current->created_at_ms : now_ms();
+        record.expires_at_ms = (current && !current->deleted) ? current->expires_at_ms : 0;
+        record.value = value;
+        record.seq = seq_no = wal_->reserve(actor_id);
+        ticket = events_.ticket(seq_no);
+        version = record.version;
+        expires_at_ms = record.expires_at_ms;
+        created_at_ms = record.created_at_ms;
+        apply(std::move(ikey), record);
+    }
+    log_reserved(ticket, seq_no, actor_id, key, value, WAL::Op::Put, version, expires_at_ms, created_at_ms);
+    notify_subscribers(ticket, actor_id, key, value, seq_no);
+    return true;
+}
+
+uint64_t LSMStore::published_seq() const {
+    // Committed first: a committed write took its ticket before it was logged,
+    // so if its event is still on the way it shows up as unpublished below
+    const uint64_t committed = wal_->committed_seq();
+    const uint64_t oldest = events_.oldest_unpublished();
+    return oldest ? std::min(committed, oldest - 1) : committed;
+}
+
+uint64_t LSMStore::subscribe(const std::string& actor_id, SubCallback callback,
+                             std::vector<KeyFilter> filters) {
+    return subscription_system_.subscribe(actor_id, std::move(callback), std::move(filters));
+}
+
+bool LSMStore::unsubscribe(const std::string& actor_id, uint64_t sub_id) {
+    return subscription_system_.unsubscribe(actor_id, sub_id);
+}
+
+void LSMStore::log_reserved(uint64_t ticket, uint64_t seq_no, const std::string& actor_id, const std::string& key,
+                            const std::string& value, WAL::Op op, uint64_t version, uint64_t expires_at_ms,
+                            uint64_t created_at_ms) {
+    try {
+        wal_->write_reserved(seq_no, actor_id, key, value, op, version, expires_at_ms, created_at_ms);
+    } catch (...) {
+        events_.post(ticket, nullptr);
+        throw;
+    }
+}
+
+void LSMStore::notify_subscribers(uint64_t ticket, const std::string& actor_id, const std::string& key,
+                                  const std::string& value, uint64_t seq_no, bool deleted) {
+    events_.post(ticket, std::make_shared<const ChangeEvent>(actor_id, key, value, seq_no, deleted));
+}
+
+void LSMStore::cleanup_expired() {
+    schedule_compaction();
+}
+
+std::optional<LSMStore::Record> LSMStore::lookup(std::string_view key) const {
+    std::shared_ptr<Memtable> mem;
+    std::deque<std::shared_ptr<Memtable>> imm;
+    std::shared_ptr<const Version> version;
+    {
+        std::lock_guard lock(state_mutex_);
+        mem = mem_;
+        imm = imm_;
+        version = version_;
+    }
+
+    std::string encoded;
+    auto found = [&]() -> std::optional<Record> {
+        Record record;
+        if (!record.decode(encoded)) {
+            throw std::runtime_error("Corrupt LSM record");
+        }
+        return record;
+    };
+    auto in_memtable = [&](const Memtable& memtable) {
+        std::shared_lock lock(memtable.mutex);
+        auto it = memtable.entries.find(key);
+        if (it == memtable.entries.end()) return false;
+        encoded = it->second;
+        return true;
+    };
+
+    if (in_memtable(*mem)) return found();
+    for (auto it = imm.rbegin(); it != imm.rend(); ++it) {
+        if (in_memtable(**it)) return found();
+    }
+    for (const auto& table : version->levels[0]) {
+        if (table->get(key, encoded)) return found();
+    }
+    for (size_t level = 1; level < version->levels.size(); ++level) {
+        const auto& tables = version->levels[level];
+        auto it = std::lower_bound(tables.begin(), tables.end(), key,
+                                   [](const auto& table, std::string_view k) { return table->largest() < k; });
+        if (it != tables.end() && (*it)->get(key, encoded)) return found();
+    }
+    return std::nullopt;
+}
+
+void LSMStore::apply(std::string key, const Record& record) {
+    std::string encoded;
+    record.encode(encoded);
+    {
+        std::unique_lock lock(mem_->mutex);
+        auto [it, inserted] = mem_->entries.try_emplace(std::move(key));
+        if (inserted) {
+            mem_->bytes += it->first.size();
+        } else {
+            mem_->bytes -= it->second.size();
+        }
+        mem_->bytes += encoded.size();
+        it->second = std::move(encoded);
+        mem_->max_seq = std::max(mem_->max_seq, record.seq);
+    }
+    if (mem_->bytes >= options_.memtable_bytes) {
+        {
+            std::lock_guard lock(state_mutex_);
+            imm_.push_back(mem_);
+            mem_ = std::make_shared<Memtable>();
+        }
+        schedule_flush();
+    }
+}
+
+void LSMStore::replay_wal(uint64_t from_seq) {
+    WALCursor cursor(*wal_, from_seq);
+    std::vector<WALCursor::EntryView> batch;
+    while (cursor.next_batch(batch, 4096, std::chrono::milliseconds(0)) > 0) {
+        for (const auto& entry : batch) {
+            std::string ikey = internal_key(entry.actor_id, entry.key);
+            Record record;
+            record.deleted = entry.op == WAL::Op::Delete;
+            record.seq = entry.seq_no;
+            // Entries logged without a version count up from what is stored, as the write did
+            if (entry.version) {
+                record.version = entry.version;
+            } else if (!record.deleted) {
+                auto current = lookup(ikey);
+                record.version = (current && !current->deleted) ? current->version + 1 : 1;
+            }
+            record.created_at_ms = entry.created_at_ms;
+            record.expires_at_ms = entry.expires_at_ms;
+            record.value.assign(entry.value.data(), entry.value.size());
+            apply(std::move(ikey), record);
+        }
+    }
+}
+
+void LSMStore::flush() {
+    {
+        std::lock_guard lock(write_mutex_);
+        std::lock_guard state(state_mutex_);
+        if (!mem_->entries.empty()) {
+            imm_.push_back(mem_);
+            mem_ = std::make_shared<Memtable>();
+        }
+    }
+    flush_frozen();
+}
+
+void LSMStore::schedule_flush() {
+    std::weak_ptr<LSMStore> weak = weak_from_this();
+    if (!thread_pool_ || weak.expired()) {
+        flush_frozen(); // no pool, or still being constructed
+        return;
+    }
+    if (flush_scheduled_.exchange(true)) {
+        return; // already queued
+    }
+    thread_pool_->SubmitBackground([weak]() {
+        if (auto self = weak.lock()) {
+            self->flush_scheduled_ = false;
+            try {
+                self->flush_frozen();
+            } catch (const std::exception& ex) {
+                std::cerr << "[LSMStore] Flush failed: " << ex.what() << "\n";
+            }
+        }
+    });
+}
+
+void LSMStore::flush_frozen() {
+    std::lock_guard serial(flush_mutex_);
+    while (true) {
+        std::shared_ptr<Memtable> oldest;
+        {
+            std::lock_guard lock(state_mutex_);
+            if (imm_.empty()) break;
+            oldest = imm_.front();
+        }
+        auto table = oldest->entries.empty() ? nullptr : write_table(oldest);
+        {
+            std::lock_guard lock(state_mutex_);
+            auto next = std::make_shared<Version>(*version_);
+            if (table) {
+                next->levels[0].insert(next->levels[0].begin(), table);
+            }
+            flushed_seq_ = std::max(flushed_seq_, oldest->max_seq);
+            write_manifest(*next);
+            version_ = next;
+            imm_.pop_front();
+        }
+        flushes_++;
+    }
+    schedule_compaction();
+}
+
+std::shared_ptr<SSTReader> LSMStore::write_table(const std::shared_ptr<Memtable>& memtable) {
+    uint64_t file_no;
+    {
+        std::lock_guard lock(state_mutex_);
+        file_no = next_file_no_++;
+    }
+    SSTWriter writer(table_path(file_no), options_.block_size, options_.bloom_bits_per_key);
+    {
+        std::shared_lock lock(memtable->mutex);
+        Record record;
+        for (const auto& [key, encoded] : memtable->entries) {
+            record.decode(encoded);
+            writer.add(key, encoded, record.seq);
+        }
+    }
+    writer.finish();
+    return std::make_shared<SSTReader>(table_path(file_no), file_no, cache_);
+}
+
+void LSMStore::schedule_compaction() {
+    std::weak_ptr<LSMStore> weak = weak_from_this();
+    if (!thread_pool_ || weak.expired()) {
+        return; // without a pool, compaction only runs through compact()
+    }
+    if (compaction_scheduled_.exchange(true)) {
+        return;
+    }
+    thread_pool_->SubmitBackground([weak]() {
+        if (auto self = weak.lock()) {
+            self->compaction_scheduled_ = false;
+            try {
+                self->compact();
+            } catch (const std::exception& ex) {
+                std::cerr << "[LSMStore] Compaction failed: " << ex.what() << "\n";
+            }
+        }
+    });
+}
+
+void LSMStore::compact() {
+    std::lock_guard serial(compaction_mutex_);
+    while (auto compaction = pick_compaction()) {
+        run_compaction(*compaction);
+    }
+}
+
+uint64_t LSMStore::max_bytes_for_level(size_t level) const {
+    uint64_t bytes = options_.level1_max_bytes;
+    for (size_t i = 1; i < level; ++i) {
+        bytes *= options_.level_multiplier;
+    }
+    return bytes;
+}
+
+std::optional<LSMStore::Compaction> LSMStore::pick_compaction() const {
+    std::shared_ptr<const Version> version;
+    {
+        std::lock_guard lock(state_mutex_);
+        version = version_;
+    }
+    auto overlapping = [](const std::vector<std::shared_ptr<SSTReader>>& tables,
+                          const std::string& lo, const std::string& hi) {
+        std::vector<std::shared_ptr<SSTReader>> out;
+        for (const auto& table : tables) {
+            if (table->largest() >= lo && table->smallest() <= hi) out.push_back(table);
+        }
+        return out;
+    };
+
+    Compaction compaction;
+    if (version->levels[0].size() >= options_.l0_compaction_trigger) {
+        // Level-0 tables overlap each other, so they all go down together
+        compaction.level = 0;
+        compaction.inputs = version->levels[0];
+    } else {
+        double best_score = 1.0;
+        size_t best_level = 0;
+        for (size_t level = 1; level + 1 < version->levels.size(); ++level) {
+            uint64_t bytes = 0;
+            for (const auto& table : version->levels[level]) bytes += table->file_size();
+            double score = static_cast<double>(bytes) / static_cast<double>(max_bytes_for_level(level));
+            if (score >= best_score) {
+                best_score = score;
+                best_level = level;
+            }
+        }
+        if (best_level == 0) {
+            return std::nullopt;
+        }
+        // Round-robin through the key space so every range gets compacted in turn
+        const auto& tables = version->levels[best_level];
+        auto it = std::find_if(tables.begin(), tables.end(), [&](const auto& table) {
+            return table->smallest() > compact_pointer_[best_level];
+        });
+        compaction.level = best_level;
+        compaction.inputs.push_back(it != tables.end() ? *it : tables.front());
+    }
+
+    std::string lo = compaction.inputs.front()->smallest();
+    std::string hi = compaction.inputs.front()->largest();
+    for (const auto& table : compaction.inputs) {
+        lo = std::min(lo, table->smallest());
+        hi = std::max(hi, table->largest());
+    }
+    compaction.overlap = overlapping(version->levels[compaction.level + 1], lo, hi);
+    return compaction;
+}
+
+void LSMStore::run_compaction(const Compaction& compaction) {
+    const size_t output_level = compaction.level + 1;
+    std::shared_ptr<const Version> version;
+    {
+        std::lock_guard lock(state_mutex_);
+        version = version_;
+    }
+    // Nothing older lives below the output, so tombstones and expired values can go
+    bool bottommost = true;
+    for (size_t level = output_level + 1; level < version->levels.size(); ++level) {
+        if (!version->levels[level].empty()) bottommost = false;
+    }
+
+    std::vector<std::shared_ptr<SSTReader>> outputs;
+    if (compaction.level > 0 && compaction.inputs.size() == 1 && compaction.overlap.empty() && !bottommost) {
+        outputs.push_back(compaction.inputs.front()); // nothing to merge with: move the table down
+    } else {
+        std::vector<std::unique_ptr<Source>> sources;
+        for (const auto& table : compaction.inputs) sources.push_back(std::make_unique<TableSource>(table));
+        for (const auto& table : compaction.overlap) sources.push_back(std::make_unique<TableSource>(table));
+        MergingIterator merged(std::move(sources));
+
+        std::unique_ptr<SSTWriter> writer;
+        uint64_t file_no = 0;
+        auto finish_output = [&]() {
+            if (!writer) return;
+            writer->finish();
+            writer.reset();
+            outputs.push_back(std::make_shared<SSTReader>(table_path(file_no), file_no, cache_));
+        };
+
+        const uint64_t now = now_ms();
+        Record record;
+        for (; merged.valid(); merged.next()) {
+            if (!record.decode(merged.value())) {
+                throw std::runtime_error("Corrupt LSM record during compaction");
+            }
+            if (bottommost && !record.live(now)) {
+                continue;
+            }
+            if (!writer) {
+                std::lock_guard lock(state_mutex_);
+                file_no = next_file_no_++;
+                writer = std::make_unique<SSTWriter>(table_path(file_no), options_.block_size,
+                                                     options_.bloom_bits_per_key);
+            }
+            writer->add(merged.key(), merged.value(), record.seq);
+            if (writer->file_size() >= options_.target_file_bytes) {
+                finish_output();
+            }
+        }
+        finish_output();
+    }
+
+    std::unordered_set<uint64_t> removed;
+    for (const auto& table : compaction.inputs) removed.insert(table->file_no());
+    for (const auto& table : compaction.overlap) removed.insert(table->file_no());
+    {
+        std::lock_guard lock(state_mutex_);
+        auto next = std::make_shared<Version>(*version_);
+        for (size_t level : {compaction.level, output_level}) {
+            auto& tables = next->levels[level];
+            tables.erase(std::remove_if(tables.begin(), tables.end(),
+                                        [&](const auto& table) { return removed.count(table->file_no()); }),
+                         tables.end());
+        }
+        auto& target = next->levels[output_level];
+        target.insert(target.end(), outputs.begin(), outputs.end());
+        std::sort(target.begin(), target.end(),
+                  [](const auto& a, const auto& b) { return a->smallest() < b->smallest(); });
+        compact_pointer_[compaction.level] = compaction.inputs.back()->largest();
+        write_manifest(*next);
+        version_ = next;
+    }
+
+    std::unordered_set<uint64_t> kept;
+    for (const auto& table : outputs) kept.insert(table->file_no());
+    for (const auto& table : compaction.inputs) {
+        if (!kept.count(table->file_no())) table->mark_obsolete();
+    }
+    for (const auto& table : compaction.overlap) table->mark_obsolete();
+    compactions_++;
+}
+
+void LSMStore::snapshot(const std::string& snapshot_path) {
+    std::vector<std::unique_ptr<Source>> sources;
+    uint64_t wal_seq;
+    {
+        // Holding the write lock gives a state that matches one WAL position
+        std::lock_guard lock(write_mutex_);
+        wal_seq = wal_->committed_seq();
+        std::shared_ptr<Memtable> mem;
+        std::deque<std::shared_ptr<Memtable>> imm;
+        std::shared_ptr<const Version> version;
+        {
+            std::lock_guard state(state_mutex_);
+            mem = mem_;
+            imm = imm_;
+            version = version_;
+        }
+        // Only the active memtable can still change, so it is the one copied
+        std::shared_ptr<const EntryMap> active;
+        {
+            std::shared_lock mem_lock(mem->mutex);
+            active = std::make_shared<const EntryMap>(mem->entries);
+        }
+        sources.push_back(std::make_unique<MapSource<EntryMap>>(active));
+        for (auto it = imm.rbegin(); it != imm.rend(); ++it) {
+            std::shared_ptr<const EntryMap> frozen(*it, &(*it)->entries);
+            sources.push_back(std::make_unique<MapSource<EntryMap>>(frozen));
+        }
+        for (const auto& tables : version->levels) {
+            for (const auto& table : tables) {
+                sources.push_back(std::make_unique<TableSource>(table));
+            }
+        }
+    }
+
+    SnapshotWriter writer(snapshot_path, wal_seq);
+    const uint64_t now = now_ms();
+    Record record;
+    for (MergingIterator merged(std::move(sources)); merged.valid(); merged.next()) {
+        std::string_view actor_id, key;
+        if (!record.decode(merged.value()) || !split_key(merged.key(), actor_id, key)) {
+            throw std::runtime_error("Corrupt LSM record during snapshot");
+        }
+        if (!record.live(now)) continue;
+        SnapshotRecord out;
+        out.actor_id = actor_id;
+        out.key = key;
+        out.value = record.value;
+        out.version = record.version;
+        out.created_at_ms = record.created_at_ms;
+        out.expires_at_ms = record.expires_at_ms;
+        writer.add(out);
+    }
+    writer.finish();
+}
+
+void LSMStore::recover_from_snapshot(const std::string& snapshot_path) {
+    std::lock_guard lock(write_mutex_);
+    SnapshotReader reader(snapshot_path);
+    {
+        std::lock_guard flush_lock(flush_mutex_);
+        std::lock_guard compaction_lock(compaction_mutex_);
+
+        // Snapshot keys are unique, so the tables written here never overlap
+        // in content and can all go into level 0 for compaction to sort out
+        std::vector<std::shared_ptr<SSTReader>> tables;
+        auto memtable = std::make_shared<Memtable>();
+        reader.for_each([&](const SnapshotRecord& in) {
+            Record record;
+            record.seq = reader.wal_seq();
+            record.version = in.version;
+            record.created_at_ms = in.created_at_ms;
+            record.expires_at_ms = in.expires_at_ms;
+            record.value.assign(in.value.data(), in.value.size());
+            std::string encoded;
+            record.encode(encoded);
+            std::string ikey = internal_key(in.actor_id, in.key);
+            memtable->bytes += ikey.size() + encoded.size();
+            memtable->entries[std::move(ikey)] = std::move(encoded);
+            if (memtable->bytes >= options_.memtable_bytes) {
+                tables.push_back(write_table(memtable));
+                memtable = std::make_shared<Memtable>();
+            }
+        });
+        if (!memtable->entries.empty()) {
+            tables.push_back(write_table(memtable));
+        }
+
+        std::shared_ptr<const Version> old;
+        {
+            std::lock_guard state(state_mutex_);
+            auto next = std::make_shared<Version>();
+            next->levels.resize(options_.num_levels);
+            next->levels[0].assign(tables.rbegin(), tables.rend());
+            mem_ = std::make_shared<Memtable>();
+            imm_.clear();
+            flushed_seq_ = reader.wal_seq();
+            std::fill(compact_pointer_.begin(), compact_pointer_.end(), std::string());
+            write_manifest(*next);
+            old = version_;
+            version_ = next;
+        }
+        for (const auto& level : old->levels) {
+            for (const auto& table : level) table->mark_obsolete();
+        }
+    }
+    replay_wal(reader.wal_seq() + 1);
+    schedule_compaction();
+}
+
+LSMStore::Stats LSMStore::stats() const {
+    Stats stats;
+    {
+        std::lock_guard lock(state_mutex_);
+        for (const auto& level : version_->levels) {
+            uint64_t bytes = 0;
+            for (const auto& table : level) bytes += table->file_size();
+            stats.files_per_level.push_back(level.size());
+            stats.bytes_per_level.push_back(bytes);
+        }
+        stats.memtable_bytes = mem_->bytes;
+        for (const auto& memtable : imm_) stats.memtable_bytes += memtable->bytes;
+    }
+    stats.flushes = flushes_.load();
+    stats.compactions = compactions_.load();
+    stats.cache_hits = cache_->hits();
+    stats.cache_misses = cache_->misses();
+    stats.bloom_skips = SSTReader::bloom_skips();
+    return stats;
+}
+
+std::string LSMStore::table_path(uint64_t file_no) const {
+    return (std::filesystem::path(dir_) / (std::to_string(file_no) + ".sst")).string();
+}
+
+void LSMStore::load_manifest() {
+    auto next = std::make_shared<Version>();
+    next->levels.resize(options_.num_levels);
+    std::unordered_set<std::string> live;
+
+    std::ifstream in((std::filesystem::path(dir_) / "MANIFEST").string());
+    std::string line;
+    if (in && getline(in, line) && line != "IQLSM 1") {
+        throw std::runtime_error("Not an LSM manifest in " + dir_);
+    }
+    while (getline(in, line)) {
+        std::istringstream fields(line);
+        std::string kind;
+        fields >> kind;
+        if (kind == "next_file") {
+            fields >> next_file_no_;
+        } else if (kind == "flushed_seq") {
+            fields >> flushed_seq_;
+        } else if (kind == "table") {
+            size_t level;
+            uint64_t file_no;
+            if (!(fields >> level >> file_no) || level >= next->levels.size()) {
+                throw std::runtime_error("Malformed LSM manifest line: " + line);
+            }
+            next->levels[level].push_back(std::make_shared<SSTReader>(table_path(file_no), file_no, cache_));
+            live.insert(std::to_string(file_no) + ".sst");
+        }
+    }
+    std::sort(next->levels[0].begin(), next->levels[0].end(),
+              [](const auto& a, const auto& b) { return a->file_no() > b->file_no(); });
+    for (size_t level = 1; level < next->levels.size(); ++level) {
+        std::sort(next->levels[level].begin(), next->levels[level].end(),
+                  [](const auto& a, const auto& b) { return a->smallest() < b->smallest(); });
+    }
+
+    // Tables of a flush or compaction that never reached the manifest
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(dir_, ec)) {
+        const auto name = entry.path().filename().string();
+        if (entry.path().extension() == ".sst" && !live.count(name)) {
+            std::filesystem::remove(entry.path(), ec);
+        }
+    }
+    version_ = next;
+}
+
+void LSMStore::write_manifest(const Version& version) {
+    // Synced before returning: compaction deletes its inputs once this names the
+    // outputs, and recovery trusts flushed_seq to skip the WAL before it
+    std::ostringstream out;
+    out << "IQLSM 1\n";
+    out << "next_file " << next_file_no_ << "\n";
+    out << "flushed_seq " << flushed_seq_ << "\n";
+    for (size_t level = 0; level < version.levels.size(); ++level) {
+        for (const auto& table : version.levels[level]) {
+            out << "table " << level << " " << table->file_no() << "\n";
+        }
+    }
+    durable_file::write_atomically((std::filesystem::path(dir_) / "MANIFEST").string(), out.str());
+}
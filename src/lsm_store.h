@@ -0,0 +1,189 @@
+#pragma once
+#include <map>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <optional>
+#include "store.h"
+#include "pubsub.h"
+#include "sst.h"
+#include "wal.h"
+#include "utils/thread_pool.h"
+
+struct LSMOptions {
+    size_t memtable_bytes = 4 * 1024 * 1024;
+    size_t block_size = 4096;
+    size_t bloom_bits_per_key = 10;
+    size_t block_cache_bytes = 64 * 1024 * 1024;
+    size_t l0_compaction_trigger = 4;
+    uint64_t level1_max_bytes = 16 * 1024 * 1024;
+    uint64_t level_multiplier = 10;
+    uint64_t target_file_bytes = 4 * 1024 * 1024;
+    size_t num_levels = 7;
+};
+
+// Persistent log-structured merge engine behind IStore, for state that does
+// not fit in memory.
+//
+// Writes go to the WAL and then to an in-memory memtable. A full memtable is
+// frozen and flushed to a level-0 SST on the pool's background lane. Level 0
+// tables may overlap; levels 1 and up are sorted runs of non-overlapping
+// tables, each level about ten times larger than the one above it. Leveled
+// compaction merges a table into the overlapping tables one level down,
+// keeping only the newest value per key and dropping tombstones and expired
+// values once nothing older can sit below them.
+//
+// Reads check the memtables, then level 0 newest first, then one table per
+// deeper level. Bloom filters skip tables without the key, and data blocks
+// are kept in a shared LRU block cache so hot keys are served from memory.
+//
+// The directory holds the tables and a MANIFEST naming the live tables and
+// the last WAL seq_no they cover; on open, the WAL is replayed from there.
+//
+// Must be owned by a shared_ptr: background work only holds a weak reference.
+class LSMStore : public IStore, public std::enable_shared_from_this<LSMStore>
+{
+public:
+    using Options = LSMOptions;
+
+    struct Stats {
+        std::vector<size_t> files_per_level;
+        std::vector<uint64_t> bytes_per_level;
+        uint64_t memtable_bytes = 0;
+        uint64_t flushes = 0;
+        uint64_t compactions = 0;
+        uint64_t cache_hits = 0;
+        uint64_t cache_misses = 0;
+        uint64_t bloom_skips = 0;
+    };
+
+    static std::shared_ptr<LSMStore> Open(const std::string& dir, std::shared_ptr<WAL> wal = nullptr,
+                                          std::shared_ptr<ThreadPool<>> thread_pool = nullptr,
+                                          Options options = Options());
+
+    LSMStore(const std::string& dir, std::shared_ptr<WAL> wal,
+             std::shared_ptr<ThreadPool<>> thread_pool, Options options);
+
+    // Writes apply to the memtable and take the WAL seq_no under write_mutex_,
+    // then log the entry once it is released and return when it is durable.
+    // Readers may see the value slightly before that.
+    bool set(const std::string& actor_id, const std::string& key, const std::string& value,
+             std::optional<int> ttl_secs = std::nullopt) override;
+    std::optional<std::string> get(const std::string& actor_id, const std::string& key) override;
+    bool del(const std::string& actor_id, const std::string& key) override;
+    bool set_if_version(const std::string& actor_id, const std::string& key,
+                        const std::string& value, uint64_t expected_version) override;
+
+    uint64_t subscribe(const std::string& actor_id, SubCallback callback,
+                       std::vector<KeyFilter> filters = {}) override;
+    bool unsubscribe(const std::string& actor_id, uint64_t sub_id) override;
+    ChangeFeed& change_feed() override { return change_feed_; }
+    uint64_t published_seq() const override;
+    // Expired values are hidden from reads and dropped by compaction; this
+    // only checks whether a compaction is due.
+    void cleanup_expired() override;
+
+    // Writes the merged view of every level in the MemStore snapshot format.
+    void snapshot(const std::string& snapshot_path) override;
+    // Replaces the contents with the snapshot, then replays later WAL entries.
+    void recover_from_snapshot(const std::string& snapshot_path) override;
+
+    // Freezes the memtable and writes it out on the calling thread.
+    void flush();
+    // Runs compactions on the calling thread until no level is over its limit.
+    void compact();
+
+    Stats stats() const;
+
+private:
+    static constexpr size_t kFeedPartitions = 16; // the change feed's, as MemStore's default shards
+
+    // A stored value: tombstone flag, WAL seq_no, version, timestamps and payload.
+    struct Record {
+        bool deleted = false;
+        uint64_t seq = 0;
+        uint64_t version = 0;
+        uint64_t created_at_ms = 0;
+        uint64_t expires_at_ms = 0; // 0 = no TTL
+        std::string value;
+
+        void encode(std::string& out) const;
+        bool decode(std::string_view in);
+        bool live(uint64_t now_ms) const { return !deleted && (!expires_at_ms || expires_at_ms > now_ms); }
+    };
+
+    struct Memtable {
+        std::map<std::string, std::string, std::less<>> entries; // internal key -> encoded Record
+        mutable std::shared_mutex mutex;
+        size_t bytes = 0;
+        uint64_t max_seq = 0;
+    };
+
+    // Immutable set of live tables. Level 0 is newest first; deeper levels are sorted by key.
+    struct Version {
+        std::vector<std::vector<std::shared_ptr<SSTReader>>> levels;
+    };
+
+    struct Compaction {
+        size_t level;
+        std::vector<std::shared_ptr<SSTReader>> inputs;  // level, newest first for level 0
+        std::vector<std::shared_ptr<SSTReader>> overlap; // level + 1
+    };
+
+    std::string dir_;
+    std::shared_ptr<WAL> wal_;
+    std::shared_ptr<ThreadPool<>> thread_pool_;
+    Options options_;
+    std::shared_ptr<BlockCache> cache_;
+    SubscriptionSystem subscription_system_;
+    ChangeFeed change_feed_{kFeedPartitions};
+    EventSequencer events_; // tickets are taken with the WAL reservation under write_mutex_
+
+    std::mutex write_mutex_;        // writers are serialised: versions are read-modify-write
+    std::mutex flush_mutex_;        // one flush at a time keeps level 0 in memtable order
+    std::mutex compaction_mutex_;   // one compaction at a time
+    mutable std::mutex state_mutex_; // guards the fields below and the manifest
+    std::shared_ptr<Memtable> mem_;
+    std::deque<std::shared_ptr<Memtable>> imm_; // frozen, oldest first
+    std::shared_ptr<const Version> version_;
+    uint64_t next_file_no_ = 1;
+    uint64_t flushed_seq_ = 0;
+    std::vector<std::string> compact_pointer_; // per level: where the next compaction starts
+
+    std::atomic<bool> flush_scheduled_{false};
+    std::atomic<bool> compaction_scheduled_{false};
+    std::atomic<uint64_t> flushes_{0};
+    std::atomic<uint64_t> compactions_{0};
+
+    static std::string internal_key(std::string_view actor_id, std::string_view key);
+    static bool split_key(std::string_view internal, std::string_view& actor_id, std::string_view& key);
+
+    std::optional<Record> lookup(std::string_view key) const;
+    // Applies a record to the memtable; caller holds write_mutex_.
+    void apply(std::string key, const Record& record);
+    void replay_wal(uint64_t from_seq);
+    // Writes a reserved entry; if that fails, gives up the ticket so later events are not held back
+    void log_reserved(uint64_t ticket, uint64_t seq_no, const std::string& actor_id, const std::string& key,
+                      const std::string& value, WAL::Op op, uint64_t version = 0, uint64_t expires_at_ms = 0,
+                      uint64_t created_at_ms = 0);
+    void notify_subscribers(uint64_t ticket, const std::string& actor_id, const std::string& key,
+                            const std::string& value, uint64_t seq_no, bool deleted = false);
+
+    void schedule_flush();
+    void flush_frozen();
+    std::shared_ptr<SSTReader> write_table(const std::shared_ptr<Memtable>& memtable);
+
+    void schedule_compaction();
+    std::optional<Compaction> pick_compaction() const;
+    void run_compaction(const Compaction& compaction);
+    uint64_t max_bytes_for_level(size_t level) const;
+
+    std::string table_path(uint64_t file_no) const;
+    void load_manifest();
+    void write_manifest(const Version& version); // caller holds state_mutex_
+};
@@ -3,53 +3,210 @@
 
 #include "server.h"
 #include "mem_store.h"
+#include "lsm_store.h"
 #include "wal.h"
+#include "wal_compactor.h"
+#include "checkpoint_manager.h"
+#include "warm_restart.h"
 #include "write_behind_worker.h"
 #include "actor_lifecycle.h"
 #include "utils/thread_pool.h"
 
+#include <filesystem>
 #include <iostream>
 #include <memory>
+#include <optional>
+#include <stdexcept>
 #include <string>
 
 using grpc::Server;
 using grpc::ServerBuilder;
 
 
+namespace {
+// Command line: [address] [--store=memory|lsm] [--data-dir=DIR] [--wal-streams=N]
+//               [--snapshot-dir=DIR]
+struct Options {
+    std::string server_address = "0.0.0.0:50051";
+    std::string store = "memory";  // memory: MemStore with images and warm restart; lsm: LSMStore
+    std::string data_dir = "lsm";  // LSMStore tables
+    // WAL files written in parallel; must match the count the existing log was written with
+    size_t wal_streams = 1;
+    // Memory store: shut down to a parallel snapshot set (one file per shard)
+    // here and recover from it, instead of the single image file
+    std::string snapshot_dir;
+};
+
+Options parse_options(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto value_of = [&arg](const std::string& flag) -> std::optional<std::string> {
+            if (arg.compare(0, flag.size() + 1, flag + "=") != 0) return std::nullopt;
+            return arg.substr(flag.size() + 1);
+        };
+        if (auto value = value_of("--store")) {
+            options.store = *value;
+        } else if (auto value = value_of("--data-dir")) {
+            options.data_dir = *value;
+        } else if (auto value = value_of("--wal-streams")) {
+            size_t parsed = 0;
+            try {
+                options.wal_streams = std::stoul(*value, &parsed);
+            } catch (const std::exception&) {
+                parsed = 0;
+            }
+            if (parsed != value->size() || options.wal_streams == 0) {
+                throw std::invalid_argument("--wal-streams must be a positive number");
+            }
+        } else if (auto value = value_of("--snapshot-dir")) {
+            options.snapshot_dir = *value;
+        } else if (arg.compare(0, 2, "--") != 0) {
+            options.server_address = arg;
+        } else {
+            throw std::invalid_argument("Unknown option " + arg);
+        }
+    }
+    if (options.store != "memory" && options.store != "lsm") {
+        throw std::invalid_argument("--store must be memory or lsm");
+    }
+    return options;
+}
+}
+
 int main(int argc, char** argv) {
-    std::string server_address("0.0.0.0:50051");
-    if (argc > 1) {
-        server_address = argv[1];  // override from CLI
+    Options options;
+    try {
+        options = parse_options(argc, argv);
+    } catch (const std::exception& ex) {
+        std::cerr << "[Iquora] " << ex.what() << std::endl;
+        return 2;
     }
-    
+    const std::string& server_address = options.server_address;
+
     // Core components
-    auto memstore = std::make_shared<MemStore>();
-    auto wal = std::make_shared<WAL>("custom.wal");
-    auto lifecycle = std::make_shared<ActorLifecycle>(memstore);
+    // One WAL for the whole write path: the store logs every write itself
+    // (during a warm restart it is rescanned once the predecessor has closed it)
+    auto wal = std::make_shared<WAL>("custom.wal", 10 * 1024 * 1024, options.wal_streams);
     auto pool = std::make_shared<ThreadPool<>>(4); // 4 threads for testing
-    auto wb = std::make_shared<WriteBehindWorker>(*memstore, *wal);
-    
+    // The memory store recovers below, once the port is bound; the LSM store
+    // replays its own WAL tail on open
+    std::shared_ptr<MemStore> memstore;
+    std::shared_ptr<IStore> store;
+    if (options.store == "lsm") {
+        store = LSMStore::Open(options.data_dir, wal, pool);
+    } else {
+        store = memstore = std::make_shared<MemStore>(wal, pool);
+    }
+    auto lifecycle = std::make_shared<ActorLifecycle>(store);
+    auto wb = std::make_shared<WriteBehindWorker>(*store, *wal);
+    auto compactor = std::make_shared<WALCompactor>(wal, pool);
+    // Checkpoints, images and warm restart are MemStore features
+    std::shared_ptr<CheckpointManager> checkpoints;
+    if (memstore) {
+        checkpoints = std::make_shared<CheckpointManager>(memstore, pool);
+    }
+
     auto service = IquoraServiceImpl::Create(
-        memstore, wal, wb, lifecycle, pool
+        store, wal, wb, lifecycle, pool
     );
 
-    // Build gRPC server
+    // Bind before recovering, holding requests until the state is in place.
+    // With SO_REUSEPORT a predecessor is still serving the same port, so during
+    // a warm restart new connections are never refused.
+    service->hold_requests();
     ServerBuilder builder;
     builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
+    builder.AddChannelArgument(GRPC_ARG_ALLOW_REUSEPORT, 1);
     builder.RegisterService(service.get());
-
     std::unique_ptr<Server> server(builder.BuildAndStart());
-    std::cout << "[Iquora] StateStore server listening on " << server_address << std::endl;
+    if (!server) {
+        std::cerr << "[Iquora] Failed to listen on " << server_address << std::endl;
+        return 1;
+    }
+
+    // Take the state straight from a running predecessor if there is one,
+    // otherwise prefer what a clean shutdown left: the image is served in
+    // place, so there is nothing to load before accepting requests, and a
+    // snapshot set (--snapshot-dir) loads all shards at once
+    const std::string handoff_socket = "iquora.handoff";
+    const std::string image_path = "iquora.img";
+    const std::string& snapshot_dir = options.snapshot_dir;
+    auto shutdown_state_exists = [&]() {
+        return snapshot_dir.empty() ? std::filesystem::exists(image_path)
+                                    : std::filesystem::exists(std::filesystem::path(snapshot_dir) / "MANIFEST");
+    };
+    if (memstore) {
+        bool adopted = false;
+        try {
+            adopted = WarmRestart::adopt(*memstore, *wal, handoff_socket);
+        } catch (const std::exception& ex) {
+            std::cerr << "[Iquora] Warm restart failed, recovering from disk: " << ex.what() << std::endl;
+            // The predecessor may have logged more since our WAL was opened
+            wal->reload();
+        }
+        if (adopted || shutdown_state_exists()) {
+            if (!adopted && snapshot_dir.empty()) {
+                memstore->recover_from_image(image_path);
+            } else if (!adopted) {
+                memstore->recover_parallel(snapshot_dir);
+            }
+            // Changes covered by the loaded state are not dirty, so restart the checkpoint chain
+            pool->SubmitBackground([checkpoints]() {
+                try {
+                    checkpoints->checkpoint(true);
+                } catch (const std::exception& ex) {
+                    std::cerr << "[Iquora] Checkpoint after image load failed: " << ex.what() << std::endl;
+                }
+            });
+        } else if (!checkpoints->recover()) {
+            // No checkpoint yet (first start, or a log from before checkpoints):
+            // the WAL is all there is
+            memstore->recover_from_wal();
+        }
+        // Recovery always rebuilds every actor in memory; idle ones go back out from here
+        memstore->enable_passivation("passivated");
+    }
+    service->release_requests();
+    std::cout << "[Iquora] StateStore server (" << options.store << ") listening on "
+              << server_address << std::endl;
+
+    // A successor is already bound when it asks; in-flight calls get a few
+    // seconds to finish before we stop and hand over
+    WarmRestart restart(handoff_socket);
+    if (memstore) {
+        restart.listen([&server]() {
+            server->Shutdown(std::chrono::system_clock::now() + std::chrono::seconds(5));
+        });
+    }
 
     // Start background workers
     wb->start();
+    compactor->start();
+    if (checkpoints) {
+        checkpoints->start(std::chrono::seconds(30));
+    }
+    lifecycle->StartPassivation(std::chrono::minutes(10), std::chrono::minutes(1));
 
     // Wait until shutdown
     server->Wait();
 
     // Stop workers cleanly
     wb->stop();
+    compactor->stop();
+    if (checkpoints) {
+        checkpoints->stop();
+    }
+    lifecycle->StopPassivation();
+    if (memstore && (!restart.requested() || !restart.hand_over(*memstore, *wal))) {
+        if (snapshot_dir.empty()) {
+            memstore->write_image(image_path);
+        } else {
+            memstore->snapshot_parallel(snapshot_dir);
+        }
+    }
+    restart.stop();
     pool->Stop();
     
     return 0;
-}
\ No newline at end of file
+}
@@ -1,54 +1,162 @@
 #include "mem_store.h"
 #include <mutex>
 #include<string>
+#include <algorithm>
+#include <filesystem>
+#include <future>
 #include "utils/thread_pool.h"
+#include "utils/common_utility.h"
+#include "snapshot.h"
+#include "wal_cursor.h"
+#include "utils/rate_limiter.h"
+
+namespace {
+uint64_t to_ms(MemStore::Clock::time_point tp) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(tp.time_since_epoch()).count();
+}
+}
 
 MemStore::MemStore(std::shared_ptr<WAL> wal,
                   std::shared_ptr<ThreadPool<>> thread_pool, 
                   DurabilityMode mode, 
-                  size_t write_behind_batch_size)
-    : wal_(wal ? wal : std::make_shared<WAL>()), durability_mode_(mode), 
-      thread_pool_(thread_pool ? thread_pool : std::make_shared<ThreadPool<>>()) {
+                  size_t write_behind_batch_size,
+                  size_t num_shards)
+    : thread_pool_(thread_pool ? thread_pool : std::make_shared<ThreadPool<>>()),
+      wal_(wal ? wal : std::make_shared<WAL>()),
+      change_feed_(std::max<size_t>(num_shards, 1)),
+      durability_mode_(mode) {
+        shards_.reserve(std::max<size_t>(num_shards, 1));
+        events_.reserve(std::max<size_t>(num_shards, 1));
+        for (size_t i = 0; i < std::max<size_t>(num_shards, 1); ++i) {
+            events_.push_back(std::make_unique<EventSequencer>(
+                [this](const EventSequencer::EventPtr& event) {
+                    subscription_system_.notify(event);
+                    change_feed_.publish(event);
+                },
+                [this](std::function<void()> drain) { thread_pool_->Submit(std::move(drain)); }));
+            shards_.push_back(std::make_unique<Shard>());
+            shards_.back()->events = events_.back().get();
+        }
         if( durability_mode_ == DurabilityMode::WriteBehind) {
             write_behind_worker_ = std::make_unique<WriteBehindWorker>(*this, *wal_, write_behind_batch_size);
             write_behind_worker_->start();
         }
       }
 
+MemStore::Shard& MemStore::shard_for(const std::string& actor_id) const {
+    return *shards_[partition_for(actor_id, shards_.size())];
+}
+
+std::vector<MemStore::PinnedShard> MemStore::pin_shards(std::shared_ptr<const SnapshotImage>& image) const {
+    std::vector<PinnedShard> pinned;
+    pinned.reserve(shards_.size());
+    for (auto& shard : shards_) {
+        std::shared_lock lock(shard->mutex);
+        pinned.push_back(PinnedShard{shard->actors, shard->passivated});
+        image = image_;
+    }
+    return pinned;
+}
+
+MemStore::KeyMap& MemStore::mutable_keys(Shard& shard, const std::string& actor_id, bool touch) {
+    load_passivated(shard, actor_id);
+    // A use count above one means a snapshot still holds this map
+    if (shard.actors.use_count() > 1) {
+        shard.actors = std::make_shared<ActorMap>(*shard.actors);
+    }
+    shard.dirty.insert(actor_id);
+    auto& keys = (*shard.actors)[actor_id];
+    if (!keys) {
+        keys = std::make_shared<ActorKeys>();
+        // First write to an actor that lives in the base image: copy its keys
+        // up, after which the overlay alone is authoritative for the actor
+        std::optional<size_t> base;
+        if (image_ && (base = image_->find_actor(actor_id))) {
+            image_->for_each_key(*base, [&](std::string_view key, const SnapshotImage::Value& stored) {
+                auto& meta = keys->keys[std::string(key)];
+                meta.value.assign(stored.value.data(), stored.value.size());
+                meta.version = stored.version;
+                meta.created_at = Clock::time_point(std::chrono::milliseconds(stored.created_at_ms));
+                if (stored.expires_at_ms) {
+                    meta.expires_at = Clock::time_point(std::chrono::milliseconds(stored.expires_at_ms));
+                    ttl_index_.push_front({actor_id, std::string(key)});
+                }
+            });
+        }
+    } else if (keys.use_count() > 1) {
+        keys = std::make_shared<ActorKeys>(*keys);
+    }
+    if (touch || !keys->last_access_ms.load(std::memory_order_relaxed)) {
+        keys->touch(to_ms(Clock::now()));
+    }
+    return keys->keys;
+}
+
 bool MemStore::set(const std::string& actor_id, const std::string& key, const std::string& value, std::optional<int> ttl_secs) {
-    // 1. Update store (synchronous)
-    std::unique_lock lock(mutex_);
-    auto& entry = store_[actor_id][key];
-    entry.value = value;
-    entry.version++;
-    entry.created_at = Clock::now();
-    entry.last_accessed = entry.created_at;
-    if (ttl_secs) {
-        entry.expires_at = entry.created_at + std::chrono::seconds(*ttl_secs);
-        ttl_index_.push_front({actor_id, key});
+    auto& shard = shard_for(actor_id);
+    uint64_t seq_no = 0, ticket;
+    uint64_t version, expires_at_ms, created_at_ms;
+    {
+        // 1. Update store and take the WAL sequence number (synchronous)
+        std::unique_lock lock(shard.mutex);
+        auto& entry = mutable_keys(shard, actor_id)[key];
+        entry.value = value;
+        entry.version++;
+        entry.created_at = Clock::now();
+        if (ttl_secs) {
+            entry.expires_at = entry.created_at + std::chrono::seconds(*ttl_secs);
+            ttl_index_.push_front({actor_id, key});
+        }
+        version = entry.version;
+        expires_at_ms = entry.expires_at ? to_ms(*entry.expires_at) : 0;
+        created_at_ms = to_ms(entry.created_at);
+        if (durability_mode_ == DurabilityMode::WriteAhead) {
+            seq_no = wal_->reserve(actor_id);
+            ticket = shard.events->ticket(seq_no);
+        } else {
+            write_behind_append(actor_id, key, value, version, expires_at_ms, created_at_ms);
+            ticket = shard.events->ticket();
+        }
     }
-    // 2. Append to WAL
-    if (durability_mode_ == DurabilityMode::WriteAhead) {
-        wal_->append(actor_id, key, value);
-    } else {
-        write_behind_append(actor_id, key, value);
+    // 2. Append to WAL outside the shard lock; returns once durable
+    if (seq_no) {
+        log_reserved(shard, ticket, seq_no, actor_id, key, value, WAL::Op::Put, version, expires_at_ms, created_at_ms);
     }
-    // 3. Notify all subscribers
-    notify_subscribers(actor_id, key, value);
-    
+    // 3. Notify all subscribers, in sequence order
+    notify_subscribers(shard, ticket, actor_id, key, value, seq_no);
+
     return true;
 }
 
 optional<std::string> MemStore::get(const std::string& actor_id, const std::string& key) {
-    std::shared_lock lock(mutex_);
-    auto it = store_.find(actor_id);
-    if (it == store_.end()) return std::nullopt;
+    auto& shard = shard_for(actor_id);
+    std::shared_lock lock(shard.mutex);
+    auto it = shard.actors->find(actor_id);
+    while (it == shard.actors->end() && shard.passivated->count(actor_id)) {
+        // Passivated while idle: loading it back needs the unique lock
+        lock.unlock();
+        {
+            std::unique_lock unique(shard.mutex);
+            load_passivated(shard, actor_id);
+        }
+        lock.lock();
+        it = shard.actors->find(actor_id);
+    }
+    if (it == shard.actors->end()) {
+        // Not written since the image was loaded: serve it from the mapping
+        if (!image_) return std::nullopt;
+        auto stored = image_->find(actor_id, key);
+        if (!stored || (stored->expires_at_ms && stored->expires_at_ms <= to_ms(Clock::now()))) {
+            return std::nullopt;
+        }
+        return std::string(stored->value);
+    }
 
-    auto keyIt = it->second.find(key);
-    if (keyIt == it->second.end()) return std::nullopt;
+    it->second->touch(to_ms(Clock::now()));
+    auto keyIt = it->second->keys.find(key);
+    if (keyIt == it->second->keys.end()) return std::nullopt;
 
-    auto& meta = keyIt->second;
-    meta.last_accessed = Clock::now();
+    const auto& meta = keyIt->second;
 
     if (meta.expires_at && Clock::now() > *meta.expires_at) {
         return std::nullopt; // expired
@@ -58,62 +166,108 @@ optional<std::string> MemStore::get(const std::string& actor_id, const std::stri
 }
 
 bool MemStore::del(const std::string& actor_id, const std::string& key) {
-    std::unique_lock lock(mutex_);
-    auto it = store_.find(actor_id);
-    if (it == store_.end()) return false;
+    auto& shard = shard_for(actor_id);
+    uint64_t seq_no = 0, ticket;
+    {
+        std::unique_lock lock(shard.mutex);
+        load_passivated(shard, actor_id);
+        if (!has_key(shard, actor_id, key)) return false;
+
+        mutable_keys(shard, actor_id).erase(key);
 
-    auto erased = it->second.erase(key);
-    return erased > 0;
+        if (durability_mode_ == DurabilityMode::WriteAhead) {
+            seq_no = wal_->reserve(actor_id);
+            ticket = shard.events->ticket(seq_no);
+        } else {
+            if (write_behind_worker_) {
+                write_behind_worker_->enqueue(WriteBehindWorker::DirtyRecord{actor_id, key, "", true});
+            }
+            ticket = shard.events->ticket();
+        }
+    }
+    // Log a tombstone so replay and compaction drop the key
+    if (seq_no) {
+        log_reserved(shard, ticket, seq_no, actor_id, key, "", WAL::Op::Delete);
+    }
+    notify_subscribers(shard, ticket, actor_id, key, "", seq_no, true);
+    return true;
 }
 
 bool MemStore::set_if_version(const std::string& actor_id, const std::string& key,
                               const std::string& value, uint64_t expected_version) {
-    std::unique_lock lock(mutex_);
-    auto& entry = store_[actor_id][key];
-    if (entry.version != expected_version) return false;
+    auto& shard = shard_for(actor_id);
+    uint64_t seq_no = 0, ticket;
+    uint64_t version, expires_at_ms, created_at_ms;
+    {
+        std::unique_lock lock(shard.mutex);
+        // Check before taking the writable map, so a stale version neither
+        // clones pinned data nor leaves an empty actor or key behind
+        load_passivated(shard, actor_id);
+        if (key_version(shard, actor_id, key) != expected_version) return false;
 
-    entry.value = value;
-    entry.version++;
-    entry.last_accessed = Clock::now();
+        auto& entry = mutable_keys(shard, actor_id)[key];
+        entry.value = value;
+        entry.version++;
+        version = entry.version;
+        expires_at_ms = entry.expires_at ? to_ms(*entry.expires_at) : 0;
+        created_at_ms = to_ms(entry.created_at);
 
-    if (durability_mode_ == DurabilityMode::WriteAhead) {
-        wal_->append(actor_id, key, value);
-    } else if (durability_mode_ == DurabilityMode::WriteBehind) {
-        write_behind_append(actor_id, key, value);
+        if (durability_mode_ == DurabilityMode::WriteAhead) {
+            seq_no = wal_->reserve(actor_id);
+            ticket = shard.events->ticket(seq_no);
+        } else {
+            write_behind_append(actor_id, key, value, version, expires_at_ms, created_at_ms);
+            ticket = shard.events->ticket();
+        }
+    }
+    if (seq_no) {
+        log_reserved(shard, ticket, seq_no, actor_id, key, value, WAL::Op::Put, version, expires_at_ms, created_at_ms);
     }
 
-    notify_subscribers(actor_id, key, value);
+    notify_subscribers(shard, ticket, actor_id, key, value, seq_no);
     return true;
 }
 
-void MemStore::notify_subscribers(const std::string& actor_id, const std::string& key, const std::string& value){
-    auto notify_handler = [key, value](const auto& cb) {
-        cb(key, value);
-    };
-    
-    if(thread_pool_){
-        thread_pool_->Submit([this, actor_id, notify_handler]() {
-            subscription_system_.notify(actor_id, notify_handler);
-        });
-    } else {
-        subscription_system_.notify(actor_id, notify_handler);
+void MemStore::log_reserved(Shard& shard, uint64_t ticket, uint64_t seq_no, const std::string& actor_id,
+                            const std::string& key, const std::string& value, WAL::Op op, uint64_t version,
+                            uint64_t expires_at_ms, uint64_t created_at_ms) {
+    try {
+        wal_->write_reserved(seq_no, actor_id, key, value, op, version, expires_at_ms, created_at_ms);
+    } catch (...) {
+        shard.events->post(ticket, nullptr);
+        throw;
     }
 }
 
-uint64_t MemStore::subscribe(const std::string& actor_id, SubCallback callback) {
-    return subscription_system_.subscribe(actor_id, 
-        [callback, actor_id](const std::string& key, const std::string& value) {
-            callback(actor_id, key, value);
-        });
+void MemStore::notify_subscribers(Shard& shard, uint64_t ticket, const std::string& actor_id, const std::string& key,
+                                  const std::string& value, uint64_t seq_no, bool deleted){
+    shard.events->post(ticket, std::make_shared<const ChangeEvent>(actor_id, key, value, seq_no, deleted));
+}
+
+uint64_t MemStore::published_seq() const {
+    // Committed first: a committed write took its ticket before it was logged,
+    // so if its event is still on the way it shows up as unpublished below
+    uint64_t published = wal_->committed_seq();
+    for (const auto& events : events_) {
+        if (const uint64_t oldest = events->oldest_unpublished()) {
+            published = std::min(published, oldest - 1);
+        }
+    }
+    return published;
+}
+
+uint64_t MemStore::subscribe(const std::string& actor_id, SubCallback callback, std::vector<KeyFilter> filters) {
+    return subscription_system_.subscribe(actor_id, std::move(callback), std::move(filters));
 }
 
 bool MemStore::unsubscribe(const std::string& actor_id, uint64_t sub_id) {
     return subscription_system_.unsubscribe(actor_id, sub_id);
 }
 
-void MemStore::write_behind_append(const std::string& actor_id, const std::string& key, const std::string& value) {
+void MemStore::write_behind_append(const std::string& actor_id, const std::string& key, const std::string& value,
+                                   uint64_t version, uint64_t expires_at_ms, uint64_t created_at_ms) {
     if (write_behind_worker_) {
-        WriteBehindWorker::DirtyRecord record{actor_id, key, value};
+        WriteBehindWorker::DirtyRecord record{actor_id, key, value, false, version, expires_at_ms, created_at_ms};
         write_behind_worker_->enqueue(record);
     }
 }
@@ -121,17 +275,649 @@ void MemStore::write_behind_append(const std::string& actor_id, const std::strin
 void MemStore::cleanup_expired() {
     ttl_index_.remove_if([this] (auto const &actor_key) {
         const auto& [actor_id, key] = actor_key;
-        auto it = store_.find(actor_id);
-        if (it == store_.end()) return true;
+        auto& shard = shard_for(actor_id);
+        std::unique_lock lock(shard.mutex);
+        auto it = shard.actors->find(actor_id);
+        if (it == shard.actors->end()) return true;
 
-        auto keyIt = it->second.find(key);
-        if (keyIt == it->second.end()) return true;
+        auto keyIt = it->second->keys.find(key);
+        if (keyIt == it->second->keys.end()) return true;
 
         auto& meta = keyIt->second;
         if (meta.expires_at && Clock::now() > *meta.expires_at) {
-            it->second.erase(key);
+            // Expiry is not an access: it must not keep the actor from passivating
+            mutable_keys(shard, actor_id, false).erase(key);
             return true;
         }
         return false;
     });
-}
\ No newline at end of file
+}
+
+void MemStore::snapshot(const std::string& snapshot_path) {
+    // Everything up to this seq_no is already applied to the shards we are about to pin
+    const uint64_t wal_seq = wal_->committed_seq();
+
+    std::shared_ptr<const SnapshotImage> image;
+    const auto pinned = pin_shards(image);
+
+    // Writers only ever clone pinned maps, so the rest runs without any lock
+    SnapshotWriter writer(snapshot_path, wal_seq);
+    const auto now = Clock::now();
+    for (const auto& shard : pinned) {
+        write_shard(writer, shard, now);
+    }
+    if (image) {
+        write_base_actors(writer, *image, pinned, now);
+    }
+    writer.finish();
+}
+
+uint64_t MemStore::write_checkpoint(const std::string& path, bool delta) {
+    const uint64_t wal_seq = wal_->committed_seq();
+
+    // Pin each shard and take its dirty set in one step, so every change is
+    // either in this checkpoint or marks its actor dirty for the next one
+    std::vector<PinnedShard> pinned;
+    std::vector<std::unordered_set<std::string>> dirty(shards_.size());
+    std::shared_ptr<const SnapshotImage> image;
+    pinned.reserve(shards_.size());
+    for (size_t i = 0; i < shards_.size(); ++i) {
+        std::unique_lock lock(shards_[i]->mutex);
+        pinned.push_back(PinnedShard{shards_[i]->actors, shards_[i]->passivated});
+        dirty[i].swap(shards_[i]->dirty);
+        image = image_;
+    }
+
+    try {
+        SnapshotWriter writer(path, wal_seq, delta ? SnapshotWriter::Delta : SnapshotWriter::Full);
+        const auto now = Clock::now();
+        for (size_t i = 0; i < pinned.size(); ++i) {
+            const auto& actors = *pinned[i].actors;
+            const auto& passivated = *pinned[i].passivated;
+            std::vector<const std::string*> actor_ids;
+            if (delta) {
+                for (const auto& actor_id : dirty[i]) actor_ids.push_back(&actor_id);
+            } else {
+                for (const auto& [actor_id, keys] : actors) actor_ids.push_back(&actor_id);
+                for (const auto& [actor_id, file] : passivated) actor_ids.push_back(&actor_id);
+            }
+            std::sort(actor_ids.begin(), actor_ids.end(), [](auto* a, auto* b) { return *a < *b; });
+
+            for (const auto* actor_id : actor_ids) {
+                auto it = actors.find(*actor_id);
+                auto parked = passivated.find(*actor_id);
+                if (it != actors.end() && !it->second->keys.empty()) {
+                    write_actor(writer, *actor_id, it->second->keys, now);
+                } else if (parked != passivated.end()) {
+                    write_passivated(writer, *parked->second, now);
+                } else if (delta) {
+                    SnapshotRecord removed;
+                    removed.actor_id = *actor_id;
+                    removed.actor_removed = true;
+                    writer.add(removed);
+                }
+            }
+        }
+        // Dirty actors never fall back to the base, so only a full checkpoint needs it
+        if (!delta && image) {
+            write_base_actors(writer, *image, pinned, now);
+        }
+        writer.finish();
+    } catch (...) {
+        // Put the dirty marks back so the next checkpoint still covers these actors
+        for (size_t i = 0; i < shards_.size(); ++i) {
+            std::unique_lock lock(shards_[i]->mutex);
+            shards_[i]->dirty.insert(dirty[i].begin(), dirty[i].end());
+        }
+        throw;
+    }
+    return wal_seq;
+}
+
+size_t MemStore::dirty_actor_count() const {
+    size_t count = 0;
+    for (const auto& shard : shards_) {
+        std::shared_lock lock(shard->mutex);
+        count += shard->dirty.size();
+    }
+    return count;
+}
+
+std::vector<const MemStore::KeyMap::value_type*> MemStore::live_entries(const KeyMap& keys,
+                                                                         Clock::time_point now) {
+    std::vector<const KeyMap::value_type*> entries;
+    entries.reserve(keys.size());
+    for (const auto& entry : keys) {
+        if (!entry.second.expires_at || *entry.second.expires_at > now) {
+            entries.push_back(&entry);
+        }
+    }
+    std::sort(entries.begin(), entries.end(), [](auto* a, auto* b) { return a->first < b->first; });
+    return entries;
+}
+
+void MemStore::write_actor(SnapshotWriter& writer, const std::string& actor_id, const KeyMap& keys,
+                           Clock::time_point now) {
+    for (const auto* entry : live_entries(keys, now)) {
+        const auto& meta = entry->second;
+        SnapshotRecord record;
+        record.actor_id = actor_id;
+        record.key = entry->first;
+        record.value = meta.value;
+        record.version = meta.version;
+        record.created_at_ms = to_ms(meta.created_at);
+        record.expires_at_ms = meta.expires_at ? to_ms(*meta.expires_at) : 0;
+        writer.add(record);
+    }
+}
+
+void MemStore::write_shard(SnapshotWriter& writer, const PinnedShard& shard, Clock::time_point now) {
+    std::vector<const std::string*> actor_ids;
+    actor_ids.reserve(shard.actors->size() + shard.passivated->size());
+    for (const auto& [actor_id, keys] : *shard.actors) {
+        actor_ids.push_back(&actor_id);
+    }
+    for (const auto& [actor_id, file] : *shard.passivated) {
+        actor_ids.push_back(&actor_id);
+    }
+    // Sorted order gives the prefix compression something to work with
+    std::sort(actor_ids.begin(), actor_ids.end(), [](auto* a, auto* b) { return *a < *b; });
+
+    for (const auto* actor_id : actor_ids) {
+        auto it = shard.actors->find(*actor_id);
+        if (it != shard.actors->end()) {
+            write_actor(writer, *actor_id, it->second->keys, now);
+        } else {
+            write_passivated(writer, *shard.passivated->at(*actor_id), now);
+        }
+    }
+}
+
+void MemStore::write_passivated(SnapshotWriter& writer, const PassivatedActor& actor, Clock::time_point now) {
+    const uint64_t now_ms = to_ms(now);
+    SnapshotReader reader(actor.path);
+    reader.for_each([&](const SnapshotRecord& record) {
+        if (record.expires_at_ms && record.expires_at_ms <= now_ms) return;
+        writer.add(record);
+    });
+}
+
+void MemStore::write_base_actors(SnapshotWriter& writer, const SnapshotImage& image,
+                                 const std::vector<PinnedShard>& pinned,
+                                 Clock::time_point now, std::optional<size_t> only_shard) {
+    const uint64_t now_ms = to_ms(now);
+    std::string actor_id;
+    for (size_t i = 0; i < image.actor_count(); ++i) {
+        actor_id.assign(image.actor_at(i));
+        const size_t shard = partition_for(actor_id, pinned.size());
+        if ((only_shard && shard != *only_shard) || pinned[shard].contains(actor_id)) {
+            continue; // another shard's, or copied up so the overlay has the current state
+        }
+        image.for_each_key(i, [&](std::string_view key, const SnapshotImage::Value& stored) {
+            if (stored.expires_at_ms && stored.expires_at_ms <= now_ms) return;
+            SnapshotRecord record;
+            record.actor_id = actor_id;
+            record.key = key;
+            record.value = stored.value;
+            record.version = stored.version;
+            record.created_at_ms = stored.created_at_ms;
+            record.expires_at_ms = stored.expires_at_ms;
+            writer.add(record);
+        });
+    }
+}
+
+void MemStore::write_image(const std::string& image_path) {
+    const uint64_t wal_seq = wal_->committed_seq();
+
+    std::shared_ptr<const SnapshotImage> image;
+    const auto pinned = pin_shards(image);
+
+    // The image needs one globally sorted actor directory, so gather every
+    // actor from both layers first; overlay entries shadow base ones
+    struct Source {
+        std::string_view actor_id;
+        const KeyMap* keys;               // both null: served from the base image
+        const PassivatedActor* passivated;
+        size_t base_index;
+    };
+    std::vector<Source> sources;
+    for (const auto& shard : pinned) {
+        for (const auto& [actor_id, keys] : *shard.actors) {
+            sources.push_back(Source{actor_id, &keys->keys, nullptr, 0});
+        }
+        for (const auto& [actor_id, file] : *shard.passivated) {
+            sources.push_back(Source{actor_id, nullptr, file.get(), 0});
+        }
+    }
+    if (image) {
+        for (size_t i = 0; i < image->actor_count(); ++i) {
+            std::string actor_id(image->actor_at(i));
+            if (!pinned[partition_for(actor_id, pinned.size())].contains(actor_id)) {
+                sources.push_back(Source{image->actor_at(i), nullptr, nullptr, i});
+            }
+        }
+    }
+    std::sort(sources.begin(), sources.end(),
+              [](const Source& a, const Source& b) { return a.actor_id < b.actor_id; });
+
+    SnapshotImageWriter writer(image_path, wal_seq);
+    const auto now = Clock::now();
+    const uint64_t now_ms = to_ms(now);
+    for (const auto& source : sources) {
+        bool started = false;
+        auto add = [&](std::string_view key, std::string_view value, uint64_t version,
+                       uint64_t created_ms, uint64_t expires_ms) {
+            if (!started) {
+                writer.begin_actor(source.actor_id);
+                started = true;
+            }
+            writer.add(key, value, version, created_ms, expires_ms);
+        };
+        if (source.keys) {
+            for (const auto* entry : live_entries(*source.keys, now)) {
+                const auto& meta = entry->second;
+                add(entry->first, meta.value, meta.version, to_ms(meta.created_at),
+                    meta.expires_at ? to_ms(*meta.expires_at) : 0);
+            }
+        } else if (source.passivated) {
+            SnapshotReader(source.passivated->path).for_each([&](const SnapshotRecord& record) {
+                if (record.expires_at_ms && record.expires_at_ms <= now_ms) return;
+                add(record.key, record.value, record.version, record.created_at_ms, record.expires_at_ms);
+            });
+        } else {
+            image->for_each_key(source.base_index, [&](std::string_view key, const SnapshotImage::Value& stored) {
+                if (stored.expires_at_ms && stored.expires_at_ms <= now_ms) return;
+                add(key, stored.value, stored.version, stored.created_at_ms, stored.expires_at_ms);
+            });
+        }
+    }
+    writer.finish();
+}
+
+void MemStore::recover_from_image(const std::string& image_path) {
+    auto image = std::make_shared<const SnapshotImage>(image_path);
+    {
+        std::vector<std::unique_lock<std::shared_mutex>> locks;
+        for (auto& shard : shards_) {
+            locks.emplace_back(shard->mutex);
+        }
+        for (auto& shard : shards_) {
+            shard->actors = std::make_shared<ActorMap>();
+            shard->passivated = std::make_shared<PassivatedMap>();
+            shard->dirty.clear();
+        }
+        image_ = image;
+    }
+    replay_wal_from(image->wal_seq() + 1);
+}
+
+bool MemStore::has_key(const Shard& shard, const std::string& actor_id, const std::string& key) const {
+    auto it = shard.actors->find(actor_id);
+    if (it != shard.actors->end()) {
+        return it->second->keys.count(key) > 0;
+    }
+    return image_ && image_->find(actor_id, key).has_value();
+}
+
+uint64_t MemStore::key_version(const Shard& shard, const std::string& actor_id, const std::string& key) const {
+    auto it = shard.actors->find(actor_id);
+    if (it != shard.actors->end()) {
+        auto keyIt = it->second->keys.find(key);
+        return keyIt == it->second->keys.end() ? 0 : keyIt->second.version;
+    }
+    if (!image_) return 0;
+    auto stored = image_->find(actor_id, key);
+    return stored ? stored->version : 0;
+}
+
+void MemStore::recover_from_snapshot(const std::string& snapshot_path) {
+    recover_from_checkpoint(snapshot_path, {});
+}
+
+void MemStore::recover_from_wal() {
+    replay_wal_from(1);
+}
+
+void MemStore::recover_from_checkpoint(const std::string& base_path,
+                                       const std::vector<std::string>& delta_paths) {
+    std::vector<std::shared_ptr<ActorMap>> loaded(shards_.size());
+    for (auto& actors : loaded) {
+        actors = std::make_shared<ActorMap>();
+    }
+    std::vector<std::pair<std::string, std::string>> with_ttl;
+
+    auto load = [&](const std::string& path) {
+        SnapshotReader reader(path);
+        const bool delta = reader.flags() & SnapshotWriter::Delta;
+        std::unordered_set<std::string> replaced;
+        reader.for_each([&](const SnapshotRecord& record) {
+            std::string actor_id(record.actor_id);
+            auto& actors = *loaded[partition_for(actor_id, shards_.size())];
+            // A delta carries the whole state of each actor it mentions
+            if (delta && replaced.insert(actor_id).second) {
+                actors.erase(actor_id);
+            }
+            if (!record.actor_removed && load_record(actors, actor_id, record)) {
+                with_ttl.emplace_back(actor_id, std::string(record.key));
+            }
+        });
+        return reader.wal_seq();
+    };
+
+    uint64_t wal_seq = load(base_path);
+    for (const auto& delta_path : delta_paths) {
+        wal_seq = load(delta_path);
+    }
+    install(std::move(loaded), with_ttl);
+
+    // Bring the state forward with everything logged after the last checkpoint
+    replay_wal_from(wal_seq + 1);
+}
+
+void MemStore::snapshot_parallel(const std::string& dir, uint64_t bytes_per_sec) {
+    const uint64_t wal_seq = wal_->committed_seq();
+
+    std::shared_ptr<const SnapshotImage> image;
+    const auto pinned = pin_shards(image);
+
+    // File names carry the WAL position, so a new set never overwrites the
+    // files of the set the current manifest still points at
+    SnapshotManifest manifest;
+    manifest.wal_seq = wal_seq;
+    for (size_t i = 0; i < pinned.size(); ++i) {
+        manifest.files.push_back("shard-" + std::to_string(i) + "." + std::to_string(wal_seq) + ".snap");
+    }
+    const std::filesystem::path root(dir);
+    std::filesystem::create_directories(root);
+
+    RateLimiter limiter(bytes_per_sec);
+    const auto now = Clock::now();
+    run_parallel(pinned.size(), [&](size_t i) {
+        SnapshotWriter writer((root / manifest.files[i]).string(), wal_seq);
+        writer.throttle(&limiter);
+        write_shard(writer, pinned[i], now);
+        if (image) {
+            write_base_actors(writer, *image, pinned, now, i);
+        }
+        writer.finish();
+    }, true);
+    manifest.write((root / "MANIFEST").string());
+
+    std::unordered_set<std::string> current(manifest.files.begin(), manifest.files.end());
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(root, ec)) {
+        const auto name = entry.path().filename().string();
+        if (entry.path().extension() == ".snap" && !current.count(name)) {
+            std::filesystem::remove(entry.path(), ec);
+        }
+    }
+}
+
+void MemStore::recover_parallel(const std::string& dir) {
+    const std::filesystem::path root(dir);
+    const auto manifest = SnapshotManifest::read((root / "MANIFEST").string());
+    const size_t files = manifest.files.size();
+
+    // Each file loads into private per-shard maps, so the loaders share nothing
+    std::vector<std::vector<std::shared_ptr<ActorMap>>> parts(files);
+    std::vector<std::vector<std::pair<std::string, std::string>>> with_ttl(files);
+    run_parallel(files, [&](size_t f) {
+        const auto path = (root / manifest.files[f]).string();
+        SnapshotReader reader(path);
+        if (reader.wal_seq() != manifest.wal_seq) {
+            throw std::runtime_error("Snapshot file does not belong to its manifest: " + path);
+        }
+        parts[f].resize(shards_.size());
+        for (auto& actors : parts[f]) {
+            actors = std::make_shared<ActorMap>();
+        }
+        std::string actor_id;
+        reader.for_each([&](const SnapshotRecord& record) {
+            actor_id.assign(record.actor_id);
+            auto& actors = *parts[f][partition_for(actor_id, shards_.size())];
+            if (load_record(actors, actor_id, record)) {
+                with_ttl[f].emplace_back(actor_id, std::string(record.key));
+            }
+        });
+    }, false);
+
+    // An actor lives in exactly one file, so merging the parts never collides
+    std::vector<std::shared_ptr<ActorMap>> loaded(shards_.size());
+    run_parallel(shards_.size(), [&](size_t i) {
+        loaded[i] = parts[0][i];
+        for (size_t f = 1; f < files; ++f) {
+            loaded[i]->merge(*parts[f][i]);
+        }
+    }, false);
+
+    std::vector<std::pair<std::string, std::string>> all_ttl;
+    for (auto& part : with_ttl) {
+        all_ttl.insert(all_ttl.end(), std::make_move_iterator(part.begin()), std::make_move_iterator(part.end()));
+    }
+    install(std::move(loaded), all_ttl);
+    replay_wal_from(manifest.wal_seq + 1);
+}
+
+bool MemStore::load_record(ActorMap& actors, const std::string& actor_id, const SnapshotRecord& record) {
+    auto& keys = actors[actor_id];
+    if (!keys) {
+        keys = std::make_shared<ActorKeys>();
+        keys->touch(to_ms(Clock::now()));
+    }
+    auto& meta = keys->keys[std::string(record.key)];
+    meta.value.assign(record.value.data(), record.value.size());
+    meta.version = record.version;
+    meta.created_at = Clock::time_point(std::chrono::milliseconds(record.created_at_ms));
+    if (record.expires_at_ms) {
+        meta.expires_at = Clock::time_point(std::chrono::milliseconds(record.expires_at_ms));
+        return true;
+    }
+    return false;
+}
+
+void MemStore::install(std::vector<std::shared_ptr<ActorMap>> loaded,
+                       const std::vector<std::pair<std::string, std::string>>& with_ttl) {
+    {
+        std::vector<std::unique_lock<std::shared_mutex>> locks;
+        for (auto& shard : shards_) {
+            locks.emplace_back(shard->mutex);
+        }
+        for (size_t i = 0; i < shards_.size(); ++i) {
+            shards_[i]->actors = std::move(loaded[i]);
+            shards_[i]->passivated = std::make_shared<PassivatedMap>();
+            shards_[i]->dirty.clear();
+        }
+        image_.reset();
+    }
+    for (const auto& actor_key : with_ttl) {
+        ttl_index_.push_front(actor_key);
+    }
+}
+
+void MemStore::run_parallel(size_t count, const std::function<void(size_t)>& task, bool background) {
+    std::vector<std::future<void>> done;
+    done.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        auto promise = std::make_shared<std::promise<void>>();
+        done.push_back(promise->get_future());
+        auto work = [promise, &task, i]() {
+            try {
+                task(i);
+                promise->set_value();
+            } catch (...) {
+                promise->set_exception(std::current_exception());
+            }
+        };
+        if (background) {
+            thread_pool_->SubmitBackground(std::move(work));
+        } else {
+            thread_pool_->Submit(std::move(work));
+        }
+    }
+    // Every task refers to the caller's frame, so all of them must finish before anything is rethrown
+    for (auto& result : done) {
+        result.wait();
+    }
+    for (auto& result : done) {
+        result.get();
+    }
+}
+
+void MemStore::replay_wal_from(uint64_t from_seq) {
+    WALCursor cursor(*wal_, from_seq);
+    std::vector<WALCursor::EntryView> batch;
+    while (cursor.next_batch(batch, 4096, std::chrono::milliseconds(0)) > 0) {
+        for (const auto& entry : batch) {
+            apply_replayed(entry);
+        }
+    }
+}
+
+void MemStore::apply_replayed(const WAL::EntryView& entry) {
+    std::string actor_id(entry.actor_id);
+    auto& shard = shard_for(actor_id);
+    std::unique_lock lock(shard.mutex);
+    load_passivated(shard, actor_id);
+    if (entry.op == WAL::Op::Delete) {
+        std::string key(entry.key);
+        if (has_key(shard, actor_id, key)) {
+            mutable_keys(shard, actor_id).erase(key);
+        }
+        return;
+    }
+    std::string key(entry.key);
+    auto& meta = mutable_keys(shard, actor_id)[key];
+    meta.value.assign(entry.value.data(), entry.value.size());
+    // Records logged before versions were recorded carry 0; count them up as the write did
+    meta.version = entry.version ? entry.version : meta.version + 1;
+    meta.created_at = Clock::time_point(std::chrono::milliseconds(entry.created_at_ms));
+    if (entry.expires_at_ms) {
+        meta.expires_at = Clock::time_point(std::chrono::milliseconds(entry.expires_at_ms));
+        ttl_index_.push_front({actor_id, key});
+    } else if (entry.version) {
+        meta.expires_at.reset();
+    }
+}
+MemStore::PassivatedActor::~PassivatedActor() {
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+}
+
+void MemStore::enable_passivation(const std::string& dir) {
+    std::filesystem::create_directories(dir);
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(dir, ec)) {
+        if (entry.path().extension() == ".actor") {
+            std::filesystem::remove(entry.path(), ec);
+        }
+    }
+    passivation_dir_ = dir;
+}
+
+std::vector<std::string> MemStore::passivate_idle(std::chrono::milliseconds idle_after) {
+    std::vector<std::string> passivated;
+    if (passivation_dir_.empty()) {
+        return passivated;
+    }
+    const auto now = Clock::now();
+    const uint64_t cutoff_ms = to_ms(now - idle_after);
+    auto idle = [cutoff_ms](const ActorKeys& actor) {
+        return !actor.keys.empty() && actor.last_access_ms.load(std::memory_order_relaxed) <= cutoff_ms;
+    };
+
+    for (auto& shard : shards_) {
+        // Holding a key map pins it: a write in the meantime clones it, which
+        // is how a changed actor is told apart when swapping below
+        std::vector<std::pair<std::string, std::shared_ptr<const ActorKeys>>> candidates;
+        uint64_t wal_seq;
+        {
+            std::shared_lock lock(shard->mutex);
+            wal_seq = wal_->committed_seq();
+            for (const auto& [actor_id, keys] : *shard->actors) {
+                if (idle(*keys)) candidates.emplace_back(actor_id, keys);
+            }
+        }
+        if (candidates.empty()) continue;
+
+        std::vector<std::shared_ptr<const PassivatedActor>> files;
+        files.reserve(candidates.size());
+        for (const auto& [actor_id, keys] : candidates) {
+            auto file = std::make_shared<PassivatedActor>();
+            file->path = (std::filesystem::path(passivation_dir_) /
+                          (std::to_string(next_passivated_file_++) + ".actor")).string();
+            SnapshotWriter writer(file->path, wal_seq);
+            write_actor(writer, actor_id, keys->keys, now);
+            writer.finish();
+            files.push_back(std::move(file));
+        }
+
+        std::unique_lock lock(shard->mutex);
+        for (size_t i = 0; i < candidates.size(); ++i) {
+            const auto& [actor_id, keys] = candidates[i];
+            auto it = shard->actors->find(actor_id);
+            if (it == shard->actors->end() || it->second != keys || !idle(*keys)) {
+                continue; // written or read while its file was being written
+            }
+            if (shard->actors.use_count() > 1) {
+                shard->actors = std::make_shared<ActorMap>(*shard->actors);
+            }
+            shard->actors->erase(actor_id);
+            if (shard->passivated.use_count() > 1) {
+                shard->passivated = std::make_shared<PassivatedMap>(*shard->passivated);
+            }
+            (*shard->passivated)[actor_id] = files[i];
+            passivated.push_back(actor_id);
+        }
+    }
+    return passivated;
+}
+
+bool MemStore::load_passivated(Shard& shard, const std::string& actor_id) {
+    auto it = shard.passivated->find(actor_id);
+    if (it == shard.passivated->end()) {
+        return false;
+    }
+    ActorMap loaded;
+    std::vector<std::string> with_ttl;
+    SnapshotReader(it->second->path).for_each([&](const SnapshotRecord& record) {
+        if (load_record(loaded, actor_id, record)) {
+            with_ttl.emplace_back(record.key);
+        }
+    });
+
+    if (shard.actors.use_count() > 1) {
+        shard.actors = std::make_shared<ActorMap>(*shard.actors);
+    }
+    auto& keys = (*shard.actors)[actor_id];
+    keys = loaded.count(actor_id) ? loaded[actor_id] : std::make_shared<ActorKeys>();
+    if (shard.passivated.use_count() > 1) {
+        shard.passivated = std::make_shared<PassivatedMap>(*shard.passivated);
+    }
+    shard.passivated->erase(actor_id);
+    for (auto& key : with_ttl) {
+        ttl_index_.push_front({actor_id, std::move(key)});
+    }
+    return true;
+}
+
+bool MemStore::is_passivated(const std::string& actor_id) const {
+    auto& shard = shard_for(actor_id);
+    std::shared_lock lock(shard.mutex);
+    return shard.passivated->count(actor_id) > 0;
+}
+
+bool MemStore::reactivate(const std::string& actor_id) {
+    auto& shard = shard_for(actor_id);
+    std::unique_lock lock(shard.mutex);
+    return load_passivated(shard, actor_id);
+}
+
+size_t MemStore::passivated_count() const {
+    size_t count = 0;
+    for (const auto& shard : shards_) {
+        std::shared_lock lock(shard->mutex);
+        count += shard->passivated->size();
+    }
+    return count;
+}
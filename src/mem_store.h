@@ -1,18 +1,25 @@
 #pragma once
 #include <unordered_map>
+#include <unordered_set>
 #include <shared_mutex>
 #include <string>
 #include <chrono>
 #include <optional>
 #include <functional>
+#include <vector>
+#include <memory>
+#include <atomic>
 #include "pubsub.h"
+#include "store.h"
+#include "snapshot.h"
+#include "snapshot_image.h"
 #include <utils/thread_pool.h>
 #include <utils/threadsafe_list.h>
 #include "wal.h"
 #include "write_behind_worker.h"
 using namespace std;
 
-class MemStore
+class MemStore : public IStore
 {
 public:
     using Clock = std::chrono::system_clock;
@@ -21,7 +28,6 @@ public:
         std::string value;
         uint64_t version = 0;
         Clock::time_point created_at;
-        Clock::time_point last_accessed;
         std::optional<Clock::time_point> expires_at;
     };
 
@@ -31,34 +37,185 @@ public:
         WriteBehind // Ack first, persist later
     };
 
-    using SubCallback = function<void(const std::string &, const std::string &, const std::string &)>;
+    using SubCallback = SubscriptionSystem::SubCallback;
 
     MemStore(std::shared_ptr<WAL> wal = nullptr, 
                 std::shared_ptr<ThreadPool<>> thread_pool = nullptr, 
                 DurabilityMode mode = DurabilityMode::WriteAhead, 
-                size_t write_behind_batch_size = 100);
+                size_t write_behind_batch_size = 100,
+                size_t num_shards = 16);
 
-    bool set(const std::string &actor_id, const std::string &key, const std::string &value, std::optional<int> ttl_secs = std::nullopt);
-    std::optional<std::string> get(const std::string &actor_id, const std::string &key);
+    // Writes apply the change and take the WAL seq_no under the shard lock, then
+    // log it once the lock is released. In WriteAhead mode they return after the
+    // entry is durable; readers may see the value slightly before that.
+    // Subscribers are notified after the entry is logged.
+    bool set(const std::string &actor_id, const std::string &key, const std::string &value, std::optional<int> ttl_secs = std::nullopt) override;
+    std::optional<std::string> get(const std::string &actor_id, const std::string &key) override;
 
-    bool del(const std::string& actor_id, const std::string& key);
+    bool del(const std::string& actor_id, const std::string& key) override;
     bool set_if_version(const std::string& actor_id, const std::string& key,
-                        const std::string& value, uint64_t expected_version);
+                        const std::string& value, uint64_t expected_version) override;
 
-    uint64_t subscribe(const std::string &actor_id, SubCallback callback);
-    bool unsubscribe(const std::string &actor_id, uint64_t sub_id);
-    void cleanup_expired();
+    uint64_t subscribe(const std::string &actor_id, SubCallback callback,
+                       std::vector<KeyFilter> filters = {}) override;
+    bool unsubscribe(const std::string &actor_id, uint64_t sub_id) override;
+    // Every change across all actors, partitioned like the shards
+    ChangeFeed& change_feed() override { return change_feed_; }
+    uint64_t published_seq() const override;
+    void cleanup_expired() override;
+
+    // Writes a point-in-time snapshot without blocking writers. The file records
+    // the WAL position it covers, so recovery is the snapshot plus the WAL tail.
+    void snapshot(const std::string& snapshot_path) override;
+    // Replaces the store contents with the snapshot, then replays later WAL entries.
+    void recover_from_snapshot(const std::string& snapshot_path) override;
+    // Replays the whole WAL, for a data dir with no snapshot or checkpoint to start from.
+    void recover_from_wal();
+
+    // Incremental checkpoints. A full checkpoint writes every actor and resets
+    // dirty tracking; a delta holds the complete state of only those actors
+    // changed since the previous checkpoint. Returns the WAL seq_no covered.
+    uint64_t write_checkpoint(const std::string& path, bool delta);
+    // Loads a base checkpoint (or snapshot), applies the deltas in order, then
+    // replays the WAL after the last of them.
+    void recover_from_checkpoint(const std::string& base_path,
+                                 const std::vector<std::string>& delta_paths);
+    size_t dirty_actor_count() const;
+
+    // Snapshot split into one file per shard under dir, tied together by
+    // dir/MANIFEST. Shards are written concurrently on the thread pool's
+    // background lane, sharing a write budget of bytes_per_sec (0 = no limit).
+    // Blocks until the set is complete, so it must not run on a pool thread.
+    void snapshot_parallel(const std::string& dir, uint64_t bytes_per_sec = 0);
+    // Loads all files of a parallel snapshot concurrently, then replays the WAL tail.
+    void recover_parallel(const std::string& dir);
+
+    // Serves the store from a mapped snapshot image. Reads go straight to the
+    // mapping and an actor is copied into memory only on its first write, so
+    // startup costs no more than replaying the WAL tail after the image.
+    void recover_from_image(const std::string& image_path);
+    // Writes both layers out as a snapshot image for the next restart.
+    void write_image(const std::string& image_path);
+
+    // Passivation: actors left idle are written to a small file each under dir
+    // and dropped from memory, so memory follows the working set. Any later
+    // read or write of such an actor loads it back first. Snapshots,
+    // checkpoints and images still include passivated actors, so the files
+    // are only a cache: leftovers from an earlier process are removed here.
+    void enable_passivation(const std::string& dir);
+    // Passivates every non-empty actor none of whose keys were touched within
+    // idle_after. Returns the ids of the actors written out.
+    std::vector<std::string> passivate_idle(std::chrono::milliseconds idle_after) override;
+    bool is_passivated(const std::string& actor_id) const override;
+    // Loads a passivated actor back into memory. Returns false if it was not passivated.
+    bool reactivate(const std::string& actor_id);
+    size_t passivated_count() const;
+
+    size_t shard_count() const { return shards_.size(); }
 
 private:
-    std::unordered_map<std::string, unordered_map<std::string, ValueMetadata>> store_;
-    mutable std::shared_mutex mutex_;
+    using KeyMap = std::unordered_map<std::string, ValueMetadata>;
+
+    // An actor's keys and when any of them was last read or written (ms since
+    // the epoch), for passivation. Reads update the tick under the shared
+    // lock, so it is atomic; a copy-on-write clone carries it over.
+    struct ActorKeys {
+        KeyMap keys;
+        mutable std::atomic<uint64_t> last_access_ms{0};
+
+        ActorKeys() = default;
+        ActorKeys(const ActorKeys& other)
+            : keys(other.keys), last_access_ms(other.last_access_ms.load(std::memory_order_relaxed)) {}
+        void touch(uint64_t now_ms) const { last_access_ms.store(now_ms, std::memory_order_relaxed); }
+    };
+    using ActorMap = std::unordered_map<std::string, std::shared_ptr<ActorKeys>>;
+
+    // The on-disk state of a passivated actor. The file is removed once no
+    // shard or pinned snapshot refers to it any more.
+    struct PassivatedActor {
+        std::string path;
+        ~PassivatedActor();
+    };
+    using PassivatedMap = std::unordered_map<std::string, std::shared_ptr<const PassivatedActor>>;
+
+    // Actors are hashed onto independent shards, each with its own lock, so
+    // writes to different shards (and their WAL streams) proceed in parallel.
+    // Shard contents are copy-on-write: a snapshot pins the current maps and
+    // writers clone whatever they touch while it is pinned.
+    struct Shard {
+        std::shared_ptr<ActorMap> actors = std::make_shared<ActorMap>();
+        std::shared_ptr<PassivatedMap> passivated = std::make_shared<PassivatedMap>(); // also copy-on-write
+        std::unordered_set<std::string> dirty; // actors changed since the last checkpoint
+        mutable std::shared_mutex mutex;
+        // Tickets are taken under the lock together with the WAL reservation,
+        // so the shard's events go out in its WAL order. Owned by events_.
+        EventSequencer* events = nullptr;
+    };
+
+    // A shard as seen by a snapshot writer. An actor is in at most one of the two maps.
+    struct PinnedShard {
+        std::shared_ptr<const ActorMap> actors;
+        std::shared_ptr<const PassivatedMap> passivated;
+        bool contains(const std::string& actor_id) const {
+            return actors->count(actor_id) || passivated->count(actor_id);
+        }
+    };
+
+    std::vector<std::unique_ptr<Shard>> shards_;
     std::shared_ptr<ThreadPool<>> thread_pool_;
     std::shared_ptr<WAL> wal_;
     SubscriptionSystem subscription_system_;
+    ChangeFeed change_feed_;
+    // One sequencer per shard, so writers only ever contend within a shard.
+    // Events are in order per shard, hence per actor and per feed partition;
+    // across shards they interleave freely (published_seq() is the position
+    // that still holds). Declared after what the sinks use, so they go first.
+    std::vector<std::unique_ptr<EventSequencer>> events_;
     std::unique_ptr<WriteBehindWorker> write_behind_worker_;
     DurabilityMode durability_mode_;
     ThreadSafeList<std::pair<std::string, std::string>> ttl_index_; // (actor_id, key)
+    // Read-only base layer under the shards. Only replaced with every shard lock held.
+    std::shared_ptr<const SnapshotImage> image_;
+    std::string passivation_dir_; // empty: passivation disabled
+    std::atomic<uint64_t> next_passivated_file_{1};
 
-    void notify_subscribers(const std::string &actor_id, const std::string &key, const std::string &value);
-    void write_behind_append(const std::string &actor_id, const std::string &key, const std::string &value);
+    Shard& shard_for(const std::string& actor_id) const;
+    std::vector<PinnedShard> pin_shards(std::shared_ptr<const SnapshotImage>& image) const;
+    // Moves a passivated actor back into the overlay. Caller holds the shard's unique lock.
+    bool load_passivated(Shard& shard, const std::string& actor_id);
+    // Writable key map for an actor, cloning pinned data first. Counts as an
+    // access unless touch is false. Caller holds the shard's unique lock.
+    KeyMap& mutable_keys(Shard& shard, const std::string& actor_id, bool touch = true);
+    void apply_replayed(const WAL::EntryView& entry);
+    void replay_wal_from(uint64_t from_seq);
+    // Looks through the overlay to the base image. Caller holds the shard's lock.
+    bool has_key(const Shard& shard, const std::string& actor_id, const std::string& key) const;
+    // The key's current version, 0 if it does not exist; same lookup as has_key.
+    uint64_t key_version(const Shard& shard, const std::string& actor_id, const std::string& key) const;
+    static std::vector<const KeyMap::value_type*> live_entries(const KeyMap& keys, Clock::time_point now);
+    static void write_shard(SnapshotWriter& writer, const PinnedShard& shard, Clock::time_point now);
+    static void write_actor(SnapshotWriter& writer, const std::string& actor_id, const KeyMap& keys,
+                            Clock::time_point now);
+    static void write_passivated(SnapshotWriter& writer, const PassivatedActor& actor, Clock::time_point now);
+    // Writes the base image actors that have not been copied up into the overlay.
+    static void write_base_actors(SnapshotWriter& writer, const SnapshotImage& image,
+                                  const std::vector<PinnedShard>& pinned,
+                                  Clock::time_point now,
+                                  std::optional<size_t> only_shard = std::nullopt);
+    // Adds a decoded record to a map being rebuilt. Returns true if the key has a TTL.
+    static bool load_record(ActorMap& actors, const std::string& actor_id, const SnapshotRecord& record);
+    // Swaps rebuilt maps in for the current contents and drops any base image.
+    void install(std::vector<std::shared_ptr<ActorMap>> loaded,
+                 const std::vector<std::pair<std::string, std::string>>& with_ttl);
+    // Runs task(0..count-1) on the thread pool and waits; rethrows the first failure.
+    void run_parallel(size_t count, const std::function<void(size_t)>& task, bool background);
+    // Posts the write's event under the ticket taken from the shard's sequencer
+    void notify_subscribers(Shard &shard, uint64_t ticket, const std::string &actor_id, const std::string &key,
+                            const std::string &value, uint64_t seq_no, bool deleted = false);
+    // Writes a reserved entry; if that fails, gives up the ticket so later events are not held back
+    void log_reserved(Shard &shard, uint64_t ticket, uint64_t seq_no, const std::string &actor_id,
+                      const std::string &key, const std::string &value, WAL::Op op, uint64_t version = 0,
+                      uint64_t expires_at_ms = 0, uint64_t created_at_ms = 0);
+    void write_behind_append(const std::string &actor_id, const std::string &key, const std::string &value,
+                             uint64_t version, uint64_t expires_at_ms, uint64_t created_at_ms);
 };
@@ -1,40 +1,159 @@
 #include "pubsub.h"
+#include "utils/common_utility.h"
+#include <algorithm>
+#include <iostream>
 
-SubscriptionSystem::SubID SubscriptionSystem::SubscriptionList::add(SubscriptionSystem::SubCallback callback) {
+bool KeyFilter::matches(const std::string &key) const {
+    switch (kind) {
+    case Kind::Key:
+        return key == pattern;
+    case Kind::Prefix:
+        return key.compare(0, pattern.size(), pattern) == 0;
+    case Kind::Glob:
+        return glob_match(pattern, key);
+    }
+    return false;
+}
+
+bool KeyFilter::any_matches(const std::vector<KeyFilter> &filters, const std::string &key) {
+    return filters.empty() ||
+           std::any_of(filters.begin(), filters.end(), [&key](const KeyFilter &filter) { return filter.matches(key); });
+}
+
+uint32_t SubscriptionSystem::Index::node_for(const std::string &text) {
+    uint32_t node = 0;
+    for (char c : text) {
+        auto &children = nodes[node].children;
+        auto it = std::lower_bound(children.begin(), children.end(), c,
+                                   [](const std::pair<char, uint32_t> &child, char k) { return child.first < k; });
+        if (it != children.end() && it->first == c) {
+            node = it->second;
+            continue;
+        }
+        const auto child = static_cast<uint32_t>(nodes.size());
+        children.insert(it, {c, child});
+        nodes.emplace_back(); // invalidates children
+        node = child;
+    }
+    return node;
+}
+
+void SubscriptionSystem::Index::build() {
+    nodes.assign(1, Node{});
+    overlapping = false;
+    for (uint32_t i = 0; i < subscribers.size(); ++i) {
+        const auto &filters = subscribers[i].filters;
+        if (filters.empty()) {
+            nodes[0].prefix.push_back(i);
+            continue;
+        }
+        overlapping |= filters.size() > 1;
+        for (uint32_t f = 0; f < filters.size(); ++f) {
+            const auto &filter = filters[f];
+            switch (filter.kind) {
+            case KeyFilter::Kind::Key:
+                nodes[node_for(filter.pattern)].exact.push_back(i);
+                break;
+            case KeyFilter::Kind::Prefix:
+                nodes[node_for(filter.pattern)].prefix.push_back(i);
+                break;
+            case KeyFilter::Kind::Glob:
+                nodes[node_for(glob_literal_prefix(filter.pattern))].globs.emplace_back(i, f);
+                break;
+            }
+        }
+    }
+}
+
+void SubscriptionSystem::Index::match(const std::string &key, std::vector<uint32_t> &out) const {
+    uint32_t node = 0;
+    size_t depth = 0;
+    while (true) {
+        const auto &current = nodes[node];
+        out.insert(out.end(), current.prefix.begin(), current.prefix.end());
+        for (const auto &[subscriber, filter] : current.globs) {
+            if (glob_match(subscribers[subscriber].filters[filter].pattern, key)) {
+                out.push_back(subscriber);
+            }
+        }
+        if (depth == key.size()) {
+            out.insert(out.end(), current.exact.begin(), current.exact.end());
+            break;
+        }
+        const char c = key[depth++];
+        auto it = std::lower_bound(current.children.begin(), current.children.end(), c,
+                                   [](const std::pair<char, uint32_t> &child, char k) { return child.first < k; });
+        if (it == current.children.end() || it->first != c) {
+            break;
+        }
+        node = it->second;
+    }
+    if (overlapping) {
+        std::sort(out.begin(), out.end());
+        out.erase(std::unique(out.begin(), out.end()), out.end());
+    }
+}
+
+void SubscriptionSystem::SubscriptionList::publish(std::vector<CallbackWrapper> subscribers) {
+    auto next = std::make_shared<Index>();
+    next->subscribers = std::move(subscribers);
+    next->build();
+    index_.store(std::move(next));
+}
+
+SubscriptionSystem::SubID SubscriptionSystem::SubscriptionList::add(SubscriptionSystem::SubCallback callback,
+                                                                    std::vector<KeyFilter> filters) {
     SubscriptionSystem::SubID id = next_id_.fetch_add(1);
-    callbacks_.push_front(CallbackWrapper(id, std::move(callback)));
+    auto shared = std::make_shared<const SubCallback>(std::move(callback));
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    auto subscribers = load()->subscribers;
+    subscribers.insert(subscribers.begin(), CallbackWrapper{id, std::move(filters), std::move(shared)}); // newest first
+    publish(std::move(subscribers));
     return id;
 }
 
 bool SubscriptionSystem::SubscriptionList::remove(SubID id) {
-    return callbacks_.remove_first_if([id](const CallbackWrapper &wrapper) {
-        return wrapper.id == id;
-    });
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    auto subscribers = load()->subscribers;
+    auto it = std::find_if(subscribers.begin(), subscribers.end(),
+                           [id](const CallbackWrapper &wrapper) { return wrapper.id == id; });
+    if (it == subscribers.end()) {
+        return false;
+    }
+    subscribers.erase(it);
+    publish(std::move(subscribers));
+    return true;
 }
 
-void SubscriptionSystem::SubscriptionList::invoke_all(NotifyHandler handler) {
-    callbacks_.for_each([&handler](const CallbackWrapper &wrapper) {
-        if (wrapper.callback) {
-            handler(wrapper.callback);
+void SubscriptionSystem::SubscriptionList::invoke_matching(const EventPtr &event) const {
+    auto index = load();
+    std::vector<uint32_t> matched;
+    index->match(event->key, matched);
+    for (uint32_t i : matched) {
+        const auto &callback = *index->subscribers[i].callback;
+        if (callback) {
+            callback(event);
         }
-    });
+    }
 }
 
 size_t SubscriptionSystem::SubscriptionList::size() const {
-    return callbacks_.size();
+    return load()->subscribers.size();
 }
 
-SubscriptionSystem::SubID SubscriptionSystem::subscribe(const std::string &actor_id, SubCallback callback) {
-    std::lock_guard<std::mutex> lock(mutex_);
+SubscriptionSystem::SubID SubscriptionSystem::subscribe(const std::string &actor_id, SubCallback callback,
+                                                        std::vector<KeyFilter> filters) {
+    // Held across add() so a concurrent unsubscribe cannot drop the list first
+    std::unique_lock lock(mutex_);
     auto &list = subscriptions_[actor_id];
     if (!list) {
-        list = std::make_unique<SubscriptionList>();
+        list = std::make_shared<SubscriptionList>();
     }
-    return list->add(std::move(callback));
+    return list->add(std::move(callback), std::move(filters));
 }
 
 bool SubscriptionSystem::unsubscribe(const std::string &actor_id, SubID id) {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::unique_lock lock(mutex_);
     auto it = subscriptions_.find(actor_id);
     if (it != subscriptions_.end()) {
         bool removed = it->second->remove(id);
@@ -46,22 +165,278 @@ bool SubscriptionSystem::unsubscribe(const std::string &actor_id, SubID id) {
     return false;
 }
 
-void SubscriptionSystem::notify(const std::string &actor_id, NotifyHandler handler) {
-    SubscriptionList* list_ptr = nullptr;
+std::shared_ptr<SubscriptionSystem::SubscriptionList> SubscriptionSystem::find(const std::string &actor_id) const {
+    std::shared_lock lock(mutex_);
+    auto it = subscriptions_.find(actor_id);
+    return it != subscriptions_.end() ? it->second : nullptr;
+}
+
+void SubscriptionSystem::notify(const EventPtr &event) {
+    if (auto list = find(event->actor_id)) {
+        list->invoke_matching(event);
+    }
+}
+
+size_t SubscriptionSystem::subscriber_count(const std::string &actor_id) const {
+    auto list = find(actor_id);
+    return list ? list->size() : 0;
+}
+
+EventSequencer::EventSequencer(Sink sink, Executor executor)
+    : state_(std::make_shared<State>()), executor_(std::move(executor)) {
+    state_->sink = std::move(sink);
+}
+
+EventSequencer::~EventSequencer() {
+    std::unique_lock<std::mutex> lock(state_->mutex);
+    state_->closed = true;
+    state_->idle.wait(lock, [this]() { return !state_->running; });
+}
+
+uint64_t EventSequencer::ticket(uint64_t seq_no) {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    const uint64_t ticket = state_->next_ticket++;
+    if (seq_no) {
+        state_->unpublished.emplace_back(ticket, seq_no);
+    }
+    return ticket;
+}
+
+uint64_t EventSequencer::oldest_unpublished() const {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    return state_->unpublished.empty() ? 0 : state_->unpublished.front().second;
+}
+
+void EventSequencer::post(uint64_t ticket, EventPtr event) {
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        auto it = subscriptions_.find(actor_id);
-        if (it == subscriptions_.end()) return;
-        list_ptr = it->second.get();
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        state_->pending.emplace(ticket, std::move(event));
+        // A running drain picks it up; otherwise only the next ticket in line starts one
+        if (state_->draining || ticket != state_->next_release) {
+            return;
+        }
+        state_->draining = true;
+    }
+    if (executor_) {
+        executor_([state = state_]() { drain(state); });
+    } else {
+        drain(state_);
     }
+}
 
-    if(list_ptr){
-        list_ptr->invoke_all(handler);
+void EventSequencer::drain(const std::shared_ptr<State> &state) {
+    std::vector<EventPtr> ready;
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->running = true;
+    while (true) {
+        ready.clear();
+        for (auto it = state->pending.begin(); it != state->pending.end() && it->first == state->next_release;
+             it = state->pending.erase(it)) {
+            ready.push_back(std::move(it->second));
+            ++state->next_release;
+        }
+        if (ready.empty() || state->closed) {
+            state->draining = false;
+            state->running = false;
+            state->idle.notify_all();
+            return;
+        }
+        lock.unlock();
+        for (const auto &event : ready) {
+            if (!event) continue;
+            try {
+                state->sink(event);
+            } catch (const std::exception &e) {
+                std::cerr << "[EventSequencer] Subscriber failed on seq " << event->seq_no << ": " << e.what()
+                          << std::endl;
+            }
+        }
+        lock.lock();
+        // Only now have these reached the subscribers
+        while (!state->unpublished.empty() && state->unpublished.front().first < state->next_release) {
+            state->unpublished.pop_front();
+        }
     }
 }
 
-size_t SubscriptionSystem::subscriber_count(const std::string &actor_id) const {
+ChangeFeed::ChangeFeed(size_t partitions) : partitions_(std::max<size_t>(partitions, 1)) {}
+
+size_t ChangeFeed::partition_of(const std::string &actor_id) const {
+    return partition_for(actor_id, partitions_.size());
+}
+
+ChangeFeed::SubID ChangeFeed::subscribe(SubCallback callback, std::string actor_prefix, std::string group,
+                                        std::vector<size_t> partitions, uint64_t delivered_seq) {
     std::lock_guard<std::mutex> lock(mutex_);
-    auto it = subscriptions_.find(actor_id);
-    return it != subscriptions_.end() ? it->second->size() : 0;
+    auto member = std::make_shared<Member>();
+    member->id = next_id_++;
+    member->actor_prefix = std::move(actor_prefix);
+    member->group = std::move(group);
+    if (member->group.empty()) {
+        for (size_t p : partitions) {
+            if (p < partitions_.size()) member->partitions.push_back(p);
+        }
+    }
+    member->callback = std::make_shared<const SubCallback>(std::move(callback));
+    members_.push_back(member);
+    if (!member->group.empty()) {
+        join_group(*member, delivered_seq);
+    }
+    rebalance();
+    return member->id;
+}
+
+bool ChangeFeed::unsubscribe(SubID id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = std::find_if(members_.begin(), members_.end(),
+                           [id](const std::shared_ptr<const Member> &member) { return member->id == id; });
+    if (it == members_.end()) {
+        return false;
+    }
+    auto member = *it;
+    members_.erase(it);
+    if (!member->group.empty()) {
+        leave_group(*member);
+    }
+    moves_.erase(id);
+    rebalance();
+    return true;
+}
+
+void ChangeFeed::join_group(const Member &member, uint64_t delivered_seq) {
+    auto [it, created] = groups_.try_emplace(member.group);
+    Group &group = it->second;
+    if (created) {
+        group.owner.assign(partitions_.size(), member.id);
+        group.acked.assign(partitions_.size(), delivered_seq);
+        return;
+    }
+    std::unordered_map<SubID, std::vector<size_t>> held;
+    for (size_t p = 0; p < group.owner.size(); ++p) {
+        held[group.owner[p]].push_back(p);
+    }
+    // Take from the most loaded member until no one holds two more than the newcomer
+    size_t taken = 0;
+    while (true) {
+        auto most = std::max_element(held.begin(), held.end(), [](const auto &a, const auto &b) {
+            return a.second.size() < b.second.size();
+        });
+        if (most->second.size() <= taken + 1) {
+            break;
+        }
+        move_partition(group, most->second.back(), member.id);
+        most->second.pop_back();
+        taken++;
+    }
+}
+
+void ChangeFeed::leave_group(const Member &member) {
+    Group &group = groups_.at(member.group);
+    std::unordered_map<SubID, size_t> load;
+    for (const auto &other : members_) {
+        if (other->group == member.group) load[other->id] = 0;
+    }
+    if (load.empty()) {
+        groups_.erase(member.group);
+        return;
+    }
+    for (SubID owner : group.owner) {
+        if (owner != member.id) load[owner]++;
+    }
+    // Each orphaned partition goes to whoever holds the fewest
+    for (size_t p = 0; p < group.owner.size(); ++p) {
+        if (group.owner[p] != member.id) continue;
+        auto least = std::min_element(load.begin(), load.end(), [](const auto &a, const auto &b) {
+            return a.second < b.second || (a.second == b.second && a.first < b.first);
+        });
+        move_partition(group, p, least->first);
+        least->second++;
+    }
+}
+
+void ChangeFeed::move_partition(Group &group, size_t partition, SubID to) {
+    group.owner[partition] = to;
+    // Recorded before the partition arrays switch, so the new owner sees the
+    // move by the time it sees the partition's first live event
+    moves_[to].push_back(Move{partition, group.acked[partition]});
+}
+
+void ChangeFeed::acknowledge(SubID id, uint64_t seq_no) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto member = std::find_if(members_.begin(), members_.end(),
+                               [id](const std::shared_ptr<const Member> &m) { return m->id == id; });
+    if (member == members_.end() || (*member)->group.empty()) {
+        return;
+    }
+    Group &group = groups_.at((*member)->group);
+    auto pending = moves_.find(id);
+    for (size_t p = 0; p < group.owner.size(); ++p) {
+        if (group.owner[p] != id) continue;
+        if (pending != moves_.end() &&
+            std::any_of(pending->second.begin(), pending->second.end(),
+                        [p](const Move &move) { return move.partition == p; })) {
+            continue; // not replayed yet
+        }
+        group.acked[p] = std::max(group.acked[p], seq_no);
+    }
+}
+
+std::vector<ChangeFeed::Move> ChangeFeed::take_moves(SubID id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = moves_.find(id);
+    if (it == moves_.end()) {
+        return {};
+    }
+    auto moves = std::move(it->second);
+    moves_.erase(it);
+    return moves;
+}
+
+std::vector<size_t> ChangeFeed::assignment_locked(const Member &member) const {
+    std::vector<size_t> assigned;
+    if (member.group.empty()) {
+        if (!member.partitions.empty()) return member.partitions;
+        for (size_t p = 0; p < partitions_.size(); ++p) assigned.push_back(p);
+        return assigned;
+    }
+    auto group = groups_.find(member.group);
+    if (group == groups_.end()) {
+        return assigned;
+    }
+    for (size_t p = 0; p < group->second.owner.size(); ++p) {
+        if (group->second.owner[p] == member.id) assigned.push_back(p);
+    }
+    return assigned;
+}
+
+std::vector<size_t> ChangeFeed::assignment(SubID id) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto &member : members_) {
+        if (member->id == id) return assignment_locked(*member);
+    }
+    return {};
+}
+
+void ChangeFeed::rebalance() {
+    std::vector<Members> next(partitions_.size());
+    for (const auto &member : members_) {
+        for (size_t p : assignment_locked(*member)) {
+            next[p].push_back(member);
+        }
+    }
+    // Each partition switches on its own; a publish sees either the old or the
+    // new array, so a group partition is never delivered twice
+    for (size_t p = 0; p < partitions_.size(); ++p) {
+        partitions_[p].members.store(std::make_shared<const Members>(std::move(next[p])));
+    }
+}
+
+void ChangeFeed::publish(const EventPtr &event) {
+    auto members = partitions_[partition_of(event->actor_id)].members.load();
+    for (const auto &member : *members) {
+        if (event->actor_id.compare(0, member->actor_prefix.size(), member->actor_prefix) == 0 &&
+            *member->callback) {
+            (*member->callback)(event);
+        }
+    }
 }
@@ -1,23 +1,79 @@
 #pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
 #include <functional>
+#include <map>
 #include <unordered_map>
 #include <string>
 #include <memory>
 #include <mutex>
-#include "utils/threadsafe_list.h"
+#include <shared_mutex>
+#include <vector>
 
+// One change, built once per write and shared by every subscriber it reaches.
+// Built in place (std::make_shared) since the encoding cache makes it immovable.
+struct ChangeEvent {
+    ChangeEvent(std::string actor_id, std::string key, std::string value, uint64_t seq_no = 0,
+                bool deleted = false)
+        : actor_id(std::move(actor_id)), key(std::move(key)), value(std::move(value)),
+          seq_no(seq_no), deleted(deleted) {}
+
+    std::string actor_id;
+    std::string key;
+    std::string value;
+    uint64_t seq_no = 0; // WAL position; 0 while not logged yet (write-behind)
+    bool deleted = false;
+    // Wire encoding, set once by the first consumer that needs one and shared
+    // by the rest. Opaque so the store does not depend on the transport.
+    mutable std::atomic<std::shared_ptr<const void>> encoded;
+};
+
+// Which keys of an actor a subscription wants. A subscription with no filters
+// gets every key; with several, a key matching any of them.
+struct KeyFilter {
+    enum class Kind { Key, Prefix, Glob };
+    Kind kind = Kind::Prefix;
+    std::string pattern;
+
+    static KeyFilter key(std::string key) { return KeyFilter{Kind::Key, std::move(key)}; }
+    static KeyFilter prefix(std::string prefix) { return KeyFilter{Kind::Prefix, std::move(prefix)}; }
+    static KeyFilter glob(std::string pattern) { return KeyFilter{Kind::Glob, std::move(pattern)}; }
+
+    bool matches(const std::string& key) const;
+    // No filters match every key
+    static bool any_matches(const std::vector<KeyFilter>& filters, const std::string& key);
+};
+
+// Per-actor subscriber registry.
+//
+// Each actor's subscribers are an immutable array published through a
+// std::atomic<std::shared_ptr>. notify() takes the registry's shared lock only
+// to look the actor up, then loads the current array and scans it with no lock
+// held, so callbacks never run under one; subscribe and unsubscribe copy the
+// array, change the copy and publish it. A notify still scanning the old array
+// keeps it alive until it is done, which is all the reclamation it needs.
+// (libstdc++ guards the atomic shared_ptr with a spin bit in the pointer
+// itself, not a global mutex pool, so unrelated arrays never contend.)
+//
+// Alongside the array each actor has a trie over the filters, rebuilt with it:
+// exact keys and prefixes hang off the node for their text, globs off the node
+// for their literal prefix. A write walks the trie along its key once, so it
+// only reaches subscribers whose filters can match.
 class SubscriptionSystem {
 public:
-    using SubCallback = std::function<void(const std::string&, const std::string&)>;
-    using NotifyHandler = std::function<void(const SubCallback&)>;
+    using EventPtr = std::shared_ptr<const ChangeEvent>;
+    using SubCallback = std::function<void(const EventPtr&)>;
     using SubID = uint64_t;
 
     // Subscription management
-    SubID subscribe(const std::string& actor_id, SubCallback callback);
+    SubID subscribe(const std::string& actor_id, SubCallback callback,
+                    std::vector<KeyFilter> filters = {});
     bool unsubscribe(const std::string& actor_id, SubID id);
 
-    // Notification
-    void notify(const std::string& actor_id, NotifyHandler handler);
+    // Notification: calls every subscriber of the event's actor whose filters match its key
+    void notify(const EventPtr& event);
 
     // Query
     size_t subscriber_count(const std::string& actor_id) const;
@@ -25,22 +81,184 @@ public:
 private:
     struct CallbackWrapper {
         SubID id;
-        SubCallback callback;
-        CallbackWrapper(SubID id, SubCallback cb) : id(id), callback(std::move(cb)) {}
+        std::vector<KeyFilter> filters;
+        std::shared_ptr<const SubCallback> callback; // shared, so copying the array is cheap
+    };
+
+    // Immutable subscriber array with its filter trie. Node and subscriber
+    // references are indices, so the whole index is a few contiguous arrays.
+    struct Index {
+        struct Node {
+            std::vector<std::pair<char, uint32_t>> children; // sorted by character
+            std::vector<uint32_t> exact;                     // key ends here
+            std::vector<uint32_t> prefix;                    // key passes through here
+            std::vector<std::pair<uint32_t, uint32_t>> globs; // (subscriber, filter) to check
+        };
+        std::vector<CallbackWrapper> subscribers;
+        std::vector<Node> nodes;
+        bool overlapping = false; // a subscriber sits at several nodes
+
+        void build();
+        uint32_t node_for(const std::string& text);
+        // Subscribers matching key, each once
+        void match(const std::string& key, std::vector<uint32_t>& out) const;
     };
 
     class SubscriptionList {
     public:
-        SubID add(SubCallback callback);
+        SubID add(SubCallback callback, std::vector<KeyFilter> filters);
         bool remove(SubID id);
-        void invoke_all(NotifyHandler handler);
+        void invoke_matching(const EventPtr& event) const;
         size_t size() const;
 
     private:
-        ThreadSafeList<CallbackWrapper> callbacks_;
+        std::shared_ptr<const Index> load() const { return index_.load(); }
+        void publish(std::vector<CallbackWrapper> subscribers);
+
+        std::atomic<std::shared_ptr<const Index>> index_{std::make_shared<const Index>()};
+        std::mutex write_mutex_; // serialises copy-and-publish
         std::atomic<SubID> next_id_{1};
     };
 
-    std::unordered_map<std::string, std::unique_ptr<SubscriptionList>> subscriptions_;
-    mutable std::mutex mutex_;
+    std::shared_ptr<SubscriptionList> find(const std::string& actor_id) const;
+
+    std::unordered_map<std::string, std::shared_ptr<SubscriptionList>> subscriptions_;
+    mutable std::shared_mutex mutex_; // guards the map, not the arrays
+};
+
+// Hands a stream of change events (a store shard's) to a sink one at a time,
+// in the order their tickets were taken, however the writers race afterwards.
+//
+// A writer takes a ticket under the lock that orders its write, logs the write
+// without the lock, then posts the event under that ticket (or nothing, if the
+// write failed). Events wait until every earlier ticket is posted. Delivery
+// runs through the executor, with at most one drain in flight, so a subscriber
+// never sees a later write before an earlier one.
+//
+// Destroying the sequencer waits for a drain that is running; a drain still
+// queued on the executor finds it gone and drops what was left.
+class EventSequencer {
+public:
+    using EventPtr = std::shared_ptr<const ChangeEvent>;
+    using Sink = std::function<void(const EventPtr&)>;
+    using Executor = std::function<void(std::function<void()>)>; // empty: drain on the posting thread
+
+    explicit EventSequencer(Sink sink, Executor executor = {});
+    ~EventSequencer();
+
+    EventSequencer(const EventSequencer&) = delete;
+    EventSequencer& operator=(const EventSequencer&) = delete;
+
+    // seq_no is the write's WAL position, if it has one yet. Tickets with one
+    // must be taken in seq_no order.
+    uint64_t ticket(uint64_t seq_no = 0);
+    // Every ticket must be posted exactly once; a null event just releases its turn.
+    void post(uint64_t ticket, EventPtr event);
+    // The lowest seq_no whose ticket has not been through the sink yet, or 0
+    // if there is none: every event below it has reached the subscribers.
+    uint64_t oldest_unpublished() const;
+
+private:
+    // Shared with queued drains, which may run after the sequencer is gone
+    struct State {
+        Sink sink;
+        std::mutex mutex;
+        std::condition_variable idle; // signalled when a running drain returns
+        uint64_t next_ticket = 1;
+        uint64_t next_release = 1;
+        std::map<uint64_t, EventPtr> pending; // posted, waiting for earlier tickets
+        std::deque<std::pair<uint64_t, uint64_t>> unpublished; // (ticket, seq_no), in ticket order
+        bool draining = false; // a drain is queued or running
+        bool running = false;  // a drain is running, and may be in the sink
+        bool closed = false;   // the sequencer is gone; the sink must not be called
+    };
+
+    static void drain(const std::shared_ptr<State>& state);
+
+    std::shared_ptr<State> state_;
+    Executor executor_;
+};
+
+// Process-wide change feed across all actors, for consumers such as indexers
+// that want every change rather than one actor's.
+//
+// Changes are split into partitions by actor hash, the same mapping the store
+// shards use. Each partition has its own copy-on-write member array, so
+// publishing only scans the members that take that partition. A subscriber
+// picks an actor-id prefix ("" = every actor) and either a set of partitions
+// or a consumer group, where each partition goes to exactly one member.
+//
+// Group assignment is sticky: a joining member takes partitions only from the
+// most loaded members, and a leaving member's partitions go to the least
+// loaded, so a rebalance moves as few partitions as it can. Members
+// acknowledge how far they have sent; each moved partition is handed to its
+// new owner with the previous owner's position, so the new owner can replay
+// from the WAL whatever was still buffered or in flight.
+class ChangeFeed {
+public:
+    using EventPtr = SubscriptionSystem::EventPtr;
+    using SubCallback = SubscriptionSystem::SubCallback;
+    using SubID = uint64_t;
+
+    explicit ChangeFeed(size_t partitions);
+
+    // partitions is ignored for group members; empty means all of them.
+    // delivered_seq is what the subscriber already has; partitions a group
+    // member starts out with, rather than takes over, count as sent up to it.
+    SubID subscribe(SubCallback callback, std::string actor_prefix = "", std::string group = "",
+                    std::vector<size_t> partitions = {}, uint64_t delivered_seq = 0);
+    bool unsubscribe(SubID id);
+
+    // A partition moved to a group member, and the seq_no up to which its
+    // previous owner had acknowledged it.
+    struct Move {
+        size_t partition;
+        uint64_t from_seq;
+    };
+    // Records that a group member has sent every change up to seq_no on the
+    // partitions it holds. Ignored for partitions it has not taken over yet.
+    void acknowledge(SubID id, uint64_t seq_no);
+    // Partitions moved to the member since the last call.
+    std::vector<Move> take_moves(SubID id);
+
+    void publish(const EventPtr& event);
+
+    size_t partition_count() const { return partitions_.size(); }
+    size_t partition_of(const std::string& actor_id) const;
+    // Partitions currently delivered to a subscriber
+    std::vector<size_t> assignment(SubID id) const;
+
+private:
+    struct Member {
+        SubID id;
+        std::string actor_prefix;
+        std::string group;
+        std::vector<size_t> partitions;
+        std::shared_ptr<const SubCallback> callback;
+    };
+    using Members = std::vector<std::shared_ptr<const Member>>;
+
+    struct Partition {
+        std::atomic<std::shared_ptr<const Members>> members{std::make_shared<const Members>()};
+    };
+
+    struct Group {
+        std::vector<SubID> owner;        // partition -> member
+        std::vector<uint64_t> acked;     // partition -> acknowledged seq_no
+    };
+
+    // Recomputes every partition's array; caller holds mutex_
+    void rebalance();
+    std::vector<size_t> assignment_locked(const Member& member) const;
+    // Sticky group changes; caller holds mutex_
+    void join_group(const Member& member, uint64_t delivered_seq);
+    void leave_group(const Member& member);
+    void move_partition(Group& group, size_t partition, SubID to);
+
+    std::vector<Partition> partitions_;
+    mutable std::mutex mutex_; // guards everything below and serialises rebalancing
+    std::vector<std::shared_ptr<const Member>> members_; // in subscription order
+    std::unordered_map<std::string, Group> groups_;
+    std::unordered_map<SubID, std::vector<Move>> moves_; // not yet taken by their member
+    SubID next_id_ = 1;
 };
@@ -1,8 +1,14 @@
 #include "server.h"
 #include "utils/common_utility.h"
+#include "utils/binary_io.h"
 
+#include <algorithm>
 #include <iostream>
 #include <chrono>
+#include <string_view>
+#include <map>
+#include <thread>
+#include <atomic>
 
 #include "proto/iquora.pb.h"
 #include <grpcpp/grpcpp.h>
@@ -13,34 +19,156 @@ using grpc::Status;
 using grpc::StatusCode;
 using grpc::ServerWriter;
 
+namespace {
+// Position of the methods in the StateStore service definition
+constexpr int kSubscribeMethod = 2;
+constexpr int kSubscribeBatchedMethod = 3;
+constexpr int kSubscribeAllMethod = 7;
+constexpr int kWatchMethod = 8;
+
+// Field 1 (events) of SubscribeBatchResponse, length-delimited
+constexpr uint8_t kBatchEventTag = (1 << 3) | 2;
+
+// The watches of one Watch stream. Each watched actor has a single store
+// subscription carrying the union of its watches' filters, re-made when they
+// change, so overlapping watches do not send an event twice.
+class WatchSet {
+public:
+    explicit WatchSet(std::shared_ptr<IStore> store) : store_(std::move(store)) {}
+
+    void attach(SubscriptionSystem::SubCallback callback) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        callback_ = std::move(callback);
+    }
+
+    // False if the id is in use or the set is closed
+    bool add(uint64_t watch_id, const std::string& actor_id, std::vector<KeyFilter> filters) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (closed_ || !watch_actor_.emplace(watch_id, actor_id).second) {
+            return false;
+        }
+        auto& actor = actors_[actor_id];
+        actor.watches.emplace(watch_id, std::move(filters));
+        resubscribe(actor_id, actor);
+        return true;
+    }
+
+    bool remove(uint64_t watch_id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = watch_actor_.find(watch_id);
+        if (closed_ || it == watch_actor_.end()) {
+            return false;
+        }
+        auto actor = actors_.find(it->second);
+        actor->second.watches.erase(watch_id);
+        if (actor->second.watches.empty()) {
+            store_->unsubscribe(actor->first, actor->second.sub_id);
+            actors_.erase(actor);
+        } else {
+            resubscribe(actor->first, actor->second);
+        }
+        watch_actor_.erase(it);
+        return true;
+    }
+
+    bool matches(std::string_view actor_id, std::string_view key) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = actors_.find(std::string(actor_id));
+        return it != actors_.end() && KeyFilter::any_matches(it->second.filters, std::string(key));
+    }
+
+    // Drops every subscription; later adds fail
+    void close() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+        for (const auto& [actor_id, actor] : actors_) {
+            store_->unsubscribe(actor_id, actor.sub_id);
+        }
+        actors_.clear();
+        watch_actor_.clear();
+    }
+
+private:
+    struct Actor {
+        uint64_t sub_id = 0;
+        std::map<uint64_t, std::vector<KeyFilter>> watches;
+        std::vector<KeyFilter> filters; // union; empty = every key
+    };
+
+    // Subscribes with the new union before dropping the old subscription, so
+    // a change in between may arrive twice but none is missed
+    void resubscribe(const std::string& actor_id, Actor& actor) {
+        std::vector<KeyFilter> filters;
+        for (const auto& [id, watch] : actor.watches) {
+            if (watch.empty()) {
+                filters.clear();
+                break;
+            }
+            filters.insert(filters.end(), watch.begin(), watch.end());
+        }
+        const uint64_t previous = actor.sub_id;
+        actor.filters = filters;
+        actor.sub_id = store_->subscribe(actor_id, callback_, std::move(filters));
+        if (previous) {
+            store_->unsubscribe(actor_id, previous);
+        }
+    }
+
+    std::shared_ptr<IStore> store_;
+    mutable std::mutex mutex_;
+    SubscriptionSystem::SubCallback callback_;
+    std::unordered_map<std::string, Actor> actors_;
+    std::unordered_map<uint64_t, std::string> watch_actor_; // watch id -> actor
+    bool closed_ = false;
+};
+}
+
 IquoraServiceImpl::IquoraServiceImpl(
-    std::shared_ptr<MemStore> memstore,
+    std::shared_ptr<IStore> store,
     std::shared_ptr<WAL> wal,
     std::shared_ptr<WriteBehindWorker> wb,
     std::shared_ptr<ActorLifecycle> lifecycle,
     std::shared_ptr<ThreadPool<>> pool)
-    : memstore_(std::move(memstore)),
+    : store_(std::move(store)),
       wal_(std::move(wal)),
       writebehind_(std::move(wb)),
       lifecycle_(std::move(lifecycle)),
-      pool_(std::move(pool)) {}
+      pool_(std::move(pool)) {
+    // The subscription streams write events already encoded as bytes: a change
+    // is serialised once and the same slice goes to every stream. The client
+    // sees the usual server-streaming messages.
+    MarkMethodStreamed(kSubscribeMethod, new grpc::internal::SplitServerStreamingHandler<
+        iquora::SubscribeRequest, grpc::ByteBuffer>(
+        [this](ServerContext* context, RawEventStream* stream) { return StreamedSubscribe(context, stream); }));
+    MarkMethodStreamed(kSubscribeBatchedMethod, new grpc::internal::SplitServerStreamingHandler<
+        iquora::SubscribeRequest, grpc::ByteBuffer>(
+        [this](ServerContext* context, RawEventStream* stream) { return StreamedSubscribeBatched(context, stream); }));
+    MarkMethodStreamed(kSubscribeAllMethod, new grpc::internal::SplitServerStreamingHandler<
+        iquora::ChangeFeedRequest, grpc::ByteBuffer>(
+        [this](ServerContext* context, RawFeedStream* stream) { return StreamedSubscribeAll(context, stream); }));
+    MarkMethodStreamed(kWatchMethod, new grpc::internal::BidiStreamingHandler<
+        iquora::StateStore::Service, iquora::WatchRequest, grpc::ByteBuffer>(
+        [this](iquora::StateStore::Service*, ServerContext* context, RawWatchStream* stream) {
+            return StreamedWatch(context, stream);
+        }, this));
+}
 
 std::shared_ptr<IquoraServiceImpl> IquoraServiceImpl::Create(
-    std::shared_ptr<MemStore> memstore,
+    std::shared_ptr<IStore> store,
     std::shared_ptr<WAL> wal,
     std::shared_ptr<WriteBehindWorker> wb,
     std::shared_ptr<ActorLifecycle> lifecycle,
     std::shared_ptr<ThreadPool<>> pool) {
     
     // Create default pointers if not provided
-    if (!memstore) memstore = std::make_shared<MemStore>();
     if (!wal) wal = std::make_shared<WAL>();
+    if (!store) store = std::make_shared<MemStore>(wal);
     if (!pool) pool = std::make_shared<ThreadPool<>>();
-    if (!lifecycle) lifecycle = std::make_shared<ActorLifecycle>(memstore);    
-    if (!wb) wb = std::make_shared<WriteBehindWorker>(*memstore, *wal);
+    if (!lifecycle) lifecycle = std::make_shared<ActorLifecycle>(store);    
+    if (!wb) wb = std::make_shared<WriteBehindWorker>(*store, *wal);
     
     return std::make_shared<IquoraServiceImpl>(
-        std::move(memstore),
+        std::move(store),
         std::move(wal),
         std::move(wb),
         std::move(lifecycle),
@@ -48,10 +176,37 @@ std::shared_ptr<IquoraServiceImpl> IquoraServiceImpl::Create(
     );
 }
 
+void IquoraServiceImpl::hold_requests() {
+    std::lock_guard<std::mutex> lock(ready_mutex_);
+    ready_ = false;
+}
+
+void IquoraServiceImpl::release_requests() {
+    {
+        std::lock_guard<std::mutex> lock(ready_mutex_);
+        ready_ = true;
+    }
+    ready_cv_.notify_all();
+}
+
+Status IquoraServiceImpl::wait_ready(ServerContext* context) {
+    std::unique_lock<std::mutex> lock(ready_mutex_);
+    while (!ready_) {
+        if (context->IsCancelled()) {
+            return Status(StatusCode::UNAVAILABLE, "Server is starting");
+        }
+        ready_cv_.wait_for(lock, std::chrono::milliseconds(100));
+    }
+    return Status::OK;
+}
+
 Status IquoraServiceImpl::Get(ServerContext* context, 
                                 const iquora::GetRequest* req,
                                 iquora::GetResponse* resp) {
-    auto val = memstore_->get(req->actor_id(), req->key());
+    if (Status held = wait_ready(context); !held.ok()) {
+        return held;
+    }
+    auto val = store_->get(req->actor_id(), req->key());
 
     if (val.has_value()) {
         resp->set_value(*val);
@@ -65,131 +220,487 @@ Status IquoraServiceImpl::Get(ServerContext* context,
 Status IquoraServiceImpl::Set(ServerContext* context, 
                                 const iquora::SetRequest* req,
                                 iquora::SetResponse* resp) {
-    bool success = memstore_->set(req->actor_id(), req->key(), req->value());     // 1) Update in-memory store
-    if (!success) {
-        resp->set_success(false);
-        return Status::OK;
+    if (Status held = wait_ready(context); !held.ok()) {
+        return held;
     }
-
-    // 2) Append to WAL synchronously (write-behind strategy: we still append here for durability)
+    // The store logs the write and notifies subscribers, gRPC streams included
     try {
-        wal_->append(req->actor_id(), req->key(), req->value());
+        resp->set_success(store_->set(req->actor_id(), req->key(), req->value()));
     } catch (const std::exception& ex) {
-        // log and continue (depending on durability settings you might want to fail)
-        std::cerr << "[SetState] WAL append failed: " << ex.what() << std::endl;
-        // We still report success to client for optimistic write-behind; adjust per policy.
+        std::cerr << "[SetState] Write failed: " << ex.what() << std::endl;
+        return Status(StatusCode::INTERNAL, ex.what());
     }
+    return Status::OK;
+}
 
-    // 3) Notify subscribers (publish change)
-    publish_change(req->actor_id(), req->key(), req->value(), "UPDATED");
+const grpc::Slice& IquoraServiceImpl::encoded(const ChangeEvent& event) {
+    auto cached = event.encoded.load();
+    if (!cached) {
+        iquora::SubscribeResponse msg;
+        msg.set_actor_id(event.actor_id);
+        msg.set_key(event.key);
+        msg.set_value(event.value);
+        msg.set_event_type(event.deleted ? "DELETED" : "UPDATED");
+        msg.set_seq_no(event.seq_no);
+        auto slice = std::make_shared<grpc::Slice>(msg.ByteSizeLong());
+        msg.SerializeWithCachedSizesToArray(const_cast<uint8_t*>(slice->begin()));
+        std::shared_ptr<const void> fresh = std::move(slice);
+        // Streams racing on a new event encode it alike; the first one in wins
+        if (event.encoded.compare_exchange_strong(cached, fresh)) {
+            cached = std::move(fresh);
+        }
+    }
+    return *static_cast<const grpc::Slice*>(cached.get());
+}
 
-    resp->set_success(true);
-    return Status::OK;
+Status IquoraServiceImpl::StreamedSubscribe(ServerContext* context, RawEventStream* stream) {
+    if (Status held = wait_ready(context); !held.ok()) {
+        return held;
+    }
+    iquora::SubscribeRequest req;
+    if (!stream->Read(&req)) {
+        return Status(StatusCode::INVALID_ARGUMENT, "Missing SubscribeRequest");
+    }
+    // One event per message: events are still taken from the ring in groups,
+    // but written one by one
+    return serve_subscription(context, req, kPopBatch, std::chrono::milliseconds(0),
+                              [stream](const std::vector<SubscriptionSystem::EventPtr>& events) {
+                                  for (const auto& event : events) {
+                                      if (!stream->Write(grpc::ByteBuffer(&encoded(*event), 1))) return false;
+                                  }
+                                  return true;
+                              });
 }
 
-void IquoraServiceImpl::publish_change(const std::string& actor_id,
-                                       const std::string& key,
-                                       const std::string& value,
-                                       const std::string& event_type) {
-    // Build the StateChange message
-    auto msg = std::make_unique<iquora::SubscribeResponse>();
-    msg->set_actor_id(actor_id);
-    msg->set_key(key);
-    msg->set_value(value);
-    msg->set_event_type(event_type);
+Status IquoraServiceImpl::StreamedSubscribeBatched(ServerContext* context, RawEventStream* stream) {
+    if (Status held = wait_ready(context); !held.ok()) {
+        return held;
+    }
+    iquora::SubscribeRequest req;
+    if (!stream->Read(&req)) {
+        return Status(StatusCode::INVALID_ARGUMENT, "Missing SubscribeRequest");
+    }
+    const size_t max_batch = std::min<size_t>(req.max_batch() ? req.max_batch() : kDefaultMaxBatch,
+                                              kMaxStreamBuffer);
+    const std::chrono::milliseconds max_latency(req.max_latency_ms() ? req.max_latency_ms()
+                                                                     : kDefaultMaxLatencyMs);
+    return serve_subscription(context, req, max_batch, max_latency, batch_writer(stream));
+}
 
-    // if we have subscribers, run callbacks in pool
-    std::shared_ptr<SubscriptionList> list;
-    {
-        std::lock_guard<std::mutex> lg(subs_map_mutex_);
-        auto it = subs_map_.find(actor_id);
-        if (it == subs_map_.end()) return;
-        list = it->second;
-    }
-
-    // iterate the threadsafe list and invoke callbacks
-    // ThreadSafeList is expected to have for_each or an iterator; I'll assume a for_each method.
-    list->callbacks.for_each([&msg](const CallbackWrapper& wrapper) {
-        // schedule on user threadpool to avoid blocking publisher
-        // capture message by value; we could move into lambda if necessary
-        try {
-            if(wrapper.callback) {
-                wrapper.callback(*msg);
-            }
-        } catch (...) {
-            // swallow callback exceptions to keep publisher robust
+IquoraServiceImpl::SendBatch IquoraServiceImpl::batch_writer(grpc::internal::WriterInterface<grpc::ByteBuffer>* stream) {
+    // A SubscribeBatchResponse is its events' encodings, each behind a field
+    // header, so the batch is assembled from the shared slices without copying them
+    return [stream, slices = std::vector<grpc::Slice>()](const std::vector<SubscriptionSystem::EventPtr>& events) mutable {
+        slices.clear();
+        std::string header;
+        for (const auto& event : events) {
+            const grpc::Slice& body = encoded(*event);
+            header.assign(1, static_cast<char>(kBatchEventTag));
+            binary_io::put_varint(header, body.size());
+            slices.emplace_back(header); // copies the few header bytes
+            slices.push_back(body);      // takes a reference
         }
-    });
+        return stream->Write(grpc::ByteBuffer(slices.data(), slices.size()));
+    };
 }
 
-std::shared_ptr<IquoraServiceImpl::SubscriptionList>
-IquoraServiceImpl::get_or_create_subs(const std::string& actor_id) {
-    std::lock_guard<std::mutex> lg(subs_map_mutex_);
-    auto it = subs_map_.find(actor_id);
-    if (it != subs_map_.end()) return it->second;
-    auto list = std::make_shared<SubscriptionList>();
-    subs_map_.emplace(actor_id, list);
-    return list;
+Status IquoraServiceImpl::StreamedSubscribeAll(ServerContext* context, RawFeedStream* stream) {
+    if (Status held = wait_ready(context); !held.ok()) {
+        return held;
+    }
+    iquora::ChangeFeedRequest req;
+    if (!stream->Read(&req)) {
+        return Status(StatusCode::INVALID_ARGUMENT, "Missing ChangeFeedRequest");
+    }
+    ChangeFeed& feed = store_->change_feed();
+    std::vector<size_t> partitions(req.partitions().begin(), req.partitions().end());
+    for (size_t p : partitions) {
+        if (p >= feed.partition_count()) {
+            return Status(StatusCode::INVALID_ARGUMENT,
+                          "Partition out of range; the feed has " + std::to_string(feed.partition_count()));
+        }
+    }
+
+    StreamPlan plan;
+    plan.policy = req.slow_consumer_policy();
+    plan.buffer_size = req.buffer_size();
+    plan.resume_from_seq = req.resume_from_seq();
+    plan.max_batch = std::min<size_t>(req.max_batch() ? req.max_batch() : kDefaultMaxBatch, kMaxStreamBuffer);
+    plan.max_latency = std::chrono::milliseconds(req.max_latency_ms() ? req.max_latency_ms() : kDefaultMaxLatencyMs);
+    // Replay on resume covers the partitions this stream holds once attached.
+    // Partitions a group rebalance moves to it later are replayed from where
+    // their previous owner had got to.
+    auto assigned = std::make_shared<std::vector<bool>>(feed.partition_count());
+    plan.attach = [&feed, &req, partitions, assigned](SubscriptionSystem::SubCallback cb, uint64_t delivered_seq) {
+        const auto id = feed.subscribe(std::move(cb), req.actor_prefix(), req.consumer_group(), partitions,
+                                       delivered_seq);
+        for (size_t p : feed.assignment(id)) (*assigned)[p] = true;
+        // Partitions taken on joining come from members that are still
+        // streaming what they buffered; only later moves need a replay
+        feed.take_moves(id);
+        return id;
+    };
+    plan.detach = [&feed](uint64_t id) { feed.unsubscribe(id); };
+    plan.replays = [&feed, &req, assigned](const WALCursor::EntryView& view) {
+        const std::string actor(view.actor_id);
+        return actor.compare(0, req.actor_prefix().size(), req.actor_prefix()) == 0 &&
+               (*assigned)[feed.partition_of(actor)];
+    };
+    if (!req.consumer_group().empty()) {
+        plan.acknowledge = [&feed](uint64_t id, uint64_t seq_no) { feed.acknowledge(id, seq_no); };
+        plan.take_moves = [&feed, &req](uint64_t id) {
+            StreamPlan::Moved moved;
+            auto moves = feed.take_moves(id);
+            if (moves.empty()) {
+                return moved;
+            }
+            auto from = std::make_shared<std::vector<uint64_t>>(feed.partition_count(), UINT64_MAX);
+            moved.from_seq = UINT64_MAX;
+            for (const auto& move : moves) {
+                (*from)[move.partition] = std::min((*from)[move.partition], move.from_seq);
+                moved.from_seq = std::min(moved.from_seq, move.from_seq);
+            }
+            moved.replays = [&feed, &req, from](const WALCursor::EntryView& view) {
+                const std::string actor(view.actor_id);
+                return actor.compare(0, req.actor_prefix().size(), req.actor_prefix()) == 0 &&
+                       view.seq_no > (*from)[feed.partition_of(actor)];
+            };
+            return moved;
+        };
+    }
+    return serve_stream(context, plan, batch_writer(stream));
 }
 
-void IquoraServiceImpl::remove_callback(const std::string& actor_id, size_t cb_id) {
-    std::lock_guard<std::mutex> lg(subs_map_mutex_);
-    auto it = subs_map_.find(actor_id);
-    if (it == subs_map_.end()) return;
-    it->second->callbacks.remove_first_if([cb_id] (const CallbackWrapper& wrapper) {
-        return wrapper.id == cb_id;
+Status IquoraServiceImpl::StreamedWatch(ServerContext* context, RawWatchStream* stream) {
+    if (Status held = wait_ready(context); !held.ok()) {
+        return held;
+    }
+    iquora::WatchRequest first;
+    if (!stream->Read(&first)) {
+        return Status(StatusCode::INVALID_ARGUMENT, "Missing WatchRequest");
+    }
+    auto watches = std::make_shared<WatchSet>(store_);
+
+    // Events are written by this thread and statuses by the reader below
+    std::mutex write_mutex;
+    auto apply = [&](const iquora::WatchRequest& req) {
+        iquora::WatchResponse reply;
+        for (const auto& add : req.add()) {
+            auto* status = reply.add_statuses();
+            status->set_watch_id(add.watch_id());
+            std::vector<KeyFilter> filters;
+            for (const auto& key : add.keys()) filters.push_back(KeyFilter::key(key));
+            for (const auto& prefix : add.key_prefixes()) filters.push_back(KeyFilter::prefix(prefix));
+            for (const auto& pattern : add.key_globs()) filters.push_back(KeyFilter::glob(pattern));
+            if (!lifecycle_->IsActorActive(add.actor_id())) {
+                status->set_error_message("Actor not found or inactive");
+            } else if (!watches->add(add.watch_id(), add.actor_id(), std::move(filters))) {
+                status->set_error_message("Watch id already in use");
+            } else {
+                status->set_success(true);
+            }
+        }
+        for (uint64_t watch_id : req.remove()) {
+            auto* status = reply.add_statuses();
+            status->set_watch_id(watch_id);
+            if (watches->remove(watch_id)) {
+                status->set_success(true);
+            } else {
+                status->set_error_message("Unknown watch id");
+            }
+        }
+        if (reply.statuses_size() == 0) {
+            return true;
+        }
+        grpc::Slice slice(reply.SerializeAsString());
+        std::lock_guard<std::mutex> lock(write_mutex);
+        return stream->Write(grpc::ByteBuffer(&slice, 1));
+    };
+
+    // The sync API blocks in Read, so commands get their own thread: two
+    // threads per watcher, however many actors it watches
+    std::thread reader;
+    std::atomic<bool> reading{true};
+    StreamPlan plan;
+    plan.policy = first.slow_consumer_policy();
+    plan.buffer_size = first.buffer_size();
+    plan.resume_from_seq = first.resume_from_seq();
+    plan.max_batch = std::min<size_t>(first.max_batch() ? first.max_batch() : kDefaultMaxBatch, kMaxStreamBuffer);
+    plan.max_latency = std::chrono::milliseconds(first.max_latency_ms() ? first.max_latency_ms()
+                                                                        : kDefaultMaxLatencyMs);
+    plan.attach = [&](SubscriptionSystem::SubCallback cb, uint64_t) {
+        watches->attach(std::move(cb));
+        apply(first);
+        reader = std::thread([&]() {
+            iquora::WatchRequest req;
+            while (stream->Read(&req) && apply(req)) {}
+            reading = false;
+        });
+        return uint64_t(0);
+    };
+    plan.detach = [&](uint64_t) { watches->close(); };
+    plan.replays = [&](const WALCursor::EntryView& view) { return watches->matches(view.actor_id, view.key); };
+
+    auto send = batch_writer(stream);
+    Status status = serve_stream(context, plan, [&](const std::vector<SubscriptionSystem::EventPtr>& events) {
+        std::lock_guard<std::mutex> lock(write_mutex);
+        return send(events);
     });
-    // optional: if list empty, erase map entry
-    if(it->second->callbacks.size() == 0) {
-        subs_map_.erase(it);
+
+    // A reader still waiting on a live client is only woken by cancelling
+    // the call, which also replaces the status the client sees
+    if (reading) {
+        context->TryCancel();
     }
+    if (reader.joinable()) {
+        reader.join();
+    }
+    return status;
 }
 
-Status IquoraServiceImpl::Subscribe(ServerContext* context, 
-                                        const iquora::SubscribeRequest* req,
-                                        ServerWriter<iquora::SubscribeResponse>* writer) {
-    const std::string actor = req->actor_id();
+Status IquoraServiceImpl::serve_subscription(ServerContext* context, const iquora::SubscribeRequest& req,
+                                             size_t max_batch, std::chrono::milliseconds max_latency,
+                                             const SendBatch& send) {
+    const std::string actor = req.actor_id();
 
     if (!lifecycle_->IsActorActive(actor)) {
         return grpc::Status(StatusCode::NOT_FOUND, "Actor not found or inactive");
     }
 
-    // Queue to receive messages for this client
-    BoundedThreadsafeQueue<std::shared_ptr<iquora::SubscribeResponse>> inbound;
+    std::vector<KeyFilter> filters;
+    for (const auto& key : req.keys()) filters.push_back(KeyFilter::key(key));
+    for (const auto& prefix : req.key_prefixes()) filters.push_back(KeyFilter::prefix(prefix));
+    for (const auto& pattern : req.key_globs()) filters.push_back(KeyFilter::glob(pattern));
 
-    // Create callback that pushes msg into inbound queue
-    auto cb = [&inbound](const iquora::SubscribeResponse& msg) {
-        auto msg_copy = std::make_shared<iquora::SubscribeResponse>(msg);
-        inbound.Push(msg_copy);
+    StreamPlan plan;
+    plan.policy = req.slow_consumer_policy();
+    plan.buffer_size = req.buffer_size();
+    plan.resume_from_seq = req.resume_from_seq();
+    plan.max_batch = max_batch;
+    plan.max_latency = max_latency;
+    plan.attach = [this, &actor, &filters](SubscriptionSystem::SubCallback cb, uint64_t) {
+        return store_->subscribe(actor, std::move(cb), filters);
+    };
+    plan.detach = [this, &actor](uint64_t id) { store_->unsubscribe(actor, id); };
+    plan.replays = [&actor, &filters](const WALCursor::EntryView& view) {
+        return view.actor_id == actor && KeyFilter::any_matches(filters, std::string(view.key));
     };
+    return serve_stream(context, plan, send);
+}
 
-    // Register callback in subscription list and keep returned id for removal
-    auto subs = get_or_create_subs(actor);
-    size_t cb_id = subs->add(cb); // add returns an id to remove later
+Status IquoraServiceImpl::serve_stream(ServerContext* context, const StreamPlan& plan, const SendBatch& send) {
+    // Fixed-size ring for this client; the publisher never waits on it, so
+    // a slow client only ever costs itself
+    const size_t capacity = std::min<size_t>(plan.buffer_size ? plan.buffer_size : kDefaultStreamBuffer,
+                                             kMaxStreamBuffer);
+    const size_t max_batch = plan.max_batch;
+    const std::chrono::milliseconds max_latency = plan.max_latency;
+    auto policy = EventRing::OverflowPolicy::DropOldest;
+    if (plan.policy == iquora::CONFLATE) policy = EventRing::OverflowPolicy::Conflate;
+    if (plan.policy == iquora::DISCONNECT) policy = EventRing::OverflowPolicy::Disconnect;
+    auto ring = std::make_shared<EventRing>(capacity, policy, [](const SubscriptionSystem::EventPtr& event) {
+        return event->actor_id + '\0' + event->key;
+    });
+    const uint64_t stream_id = register_stream(ring);
 
-    // Stream loop: block on inbound queue and write to client, exit on client cancellation
-    while (!context->IsCancelled()) {
-        auto msg = std::make_shared<iquora::SubscribeResponse>();
-        bool success = inbound.WaitAndPop(msg, std::chrono::milliseconds(500)); // wait up to 500ms
-        if (!success) {
+    // The client has everything before resume_from_seq. A fresh subscription
+    // counts everything published so far as delivered: a resumed client gets
+    // at least what it would have seen from now on
+    uint64_t delivered_seq = plan.resume_from_seq ? plan.resume_from_seq - 1 : store_->published_seq();
+
+    // Attach to the change events; the callback only pushes into the ring and
+    // holds its own reference, as it may still run after detaching
+    const uint64_t sub_id = plan.attach([ring](const SubscriptionSystem::EventPtr& event) {
+        ring->Push(event);
+    }, delivered_seq);
+
+    std::vector<SubscriptionSystem::EventPtr> pending;
+    auto flush = [&]() {
+        if (pending.empty()) {
+            return true;
+        }
+        if (!send(pending)) {
+            return false;
+        }
+        pending.clear();
+        return true;
+    };
+    // Live events are not in seq_no order: stores publish each shard on its
+    // own, and CONFLATE replaces buffered events in place. So how far the
+    // client has got is taken from the store instead: once everything the
+    // ring held when published_seq() was read has left it, sent or dropped by
+    // the policy, the client has all it will get up to that seq_no.
+    auto advance = [&](uint64_t published) {
+        if (published <= delivered_seq) {
+            return;
+        }
+        delivered_seq = published;
+        if (plan.acknowledge) {
+            plan.acknowledge(sub_id, delivered_seq);
+        }
+    };
+    // Sends the logged changes in (from_seq, to_seq] that replays selects
+    auto replay = [&](uint64_t from_seq, uint64_t to_seq, const StreamPlan::Replays& replays) {
+        WALCursor cursor(*wal_, from_seq + 1);
+        std::vector<WALCursor::EntryView> batch;
+        while (cursor.position() <= to_seq && !context->IsCancelled()) {
+            if (cursor.next_batch(batch, 512, std::chrono::milliseconds(0)) == 0) {
+                break;
+            }
+            for (const auto& view : batch) {
+                if (view.seq_no > to_seq) break;
+                if (!replays(view)) continue;
+                pending.push_back(std::make_shared<const ChangeEvent>(
+                    std::string(view.actor_id), std::string(view.key), std::string(view.value), view.seq_no, view.op == WAL::Op::Delete));
+                if (pending.size() >= max_batch && !flush()) {
+                    return false;
+                }
+            }
+        }
+        return flush();
+    };
+
+    // Catch up from the WAL before going live. Live events are already
+    // buffering; everything committed by now is replayed here, so live events
+    // up to that point are duplicates and skipped below
+    bool open = true;
+    uint64_t replayed_seq = 0;
+    if (plan.resume_from_seq && plan.resume_from_seq <= wal_->committed_seq()) {
+        replayed_seq = wal_->committed_seq();
+        open = replay(plan.resume_from_seq - 1, replayed_seq, plan.replays);
+        delivered_seq = std::max(delivered_seq, replayed_seq);
+    }
+
+    // Partitions moved to this stream by a group rebalance: replay each from
+    // where its previous owner had got to, then skip the live duplicates
+    std::vector<std::pair<uint64_t, StreamPlan::Replays>> moved_replays;
+    auto catch_up_moves = [&]() {
+        if (!plan.take_moves) {
+            return true;
+        }
+        auto moved = plan.take_moves(sub_id);
+        if (!moved.replays) {
+            return true;
+        }
+        const uint64_t to_seq = wal_->committed_seq();
+        moved_replays.emplace_back(to_seq, moved.replays);
+        return moved.from_seq >= to_seq || replay(moved.from_seq, to_seq, moved.replays);
+    };
+    auto replayed = [&](const SubscriptionSystem::EventPtr& event) {
+        if (!event->seq_no) {
+            return false;
+        }
+        if (event->seq_no <= replayed_seq) {
+            return true;
+        }
+        const WALCursor::EntryView view{event->seq_no, 0, event->actor_id, event->key, event->value};
+        return std::any_of(moved_replays.begin(), moved_replays.end(), [&](const auto& moved) {
+            return event->seq_no <= moved.first && moved.second(view);
+        });
+    };
+
+    // Stream loop: block on the ring and write to client, exit on client cancellation
+    Status status = Status::OK;
+    std::vector<SubscriptionSystem::EventPtr> events;
+    while (open && !context->IsCancelled()) {
+        // Read before the ring's tail: every event published by now is buffered ahead of mark
+        const uint64_t published = store_->published_seq();
+        const uint64_t mark = ring->TailPosition();
+        auto drained = [&]() { return ring->HeadPosition() >= mark && !ring->Overflowed(); };
+        if (ring->WaitAndPopBatch(events, max_batch, std::chrono::milliseconds(500)) == 0) { // wait up to 500ms
+            if (!catch_up_moves()) {
+                break;
+            }
+            if (ring->Overflowed()) {
+                // Disconnect policy: hand the client the position to resume from
+                context->AddTrailingMetadata("iquora-resume-token", std::to_string(delivered_seq + 1));
+                status = Status(StatusCode::RESOURCE_EXHAUSTED, "Subscriber fell behind; resume from the token");
+                disconnects_++;
+                break;
+            }
             // timed out, check cancellation again
+            if (drained()) {
+                advance(published);
+            }
             continue;
         }
+        // Adapt to the queue: a lone event goes out at once, but when more
+        // were waiting the stream is busy, so linger up to max_latency for a
+        // fuller batch
+        if (max_latency.count() > 0 && events.size() > 1 && events.size() < max_batch) {
+            ring->FillBatch(events, max_batch - events.size(), std::chrono::steady_clock::now() + max_latency);
+        }
+        // A move is recorded before its partition's first live event is
+        // published, so any moved partition in this batch is caught up first
+        if (!catch_up_moves()) {
+            break;
+        }
+        for (const auto& event : events) {
+            if (replayed(event)) {
+                continue; // sent by a replay
+            }
+            pending.push_back(event);
+        }
         // Write to the stream; if client disconnected, break
-        if (!writer->Write(*msg)) {
+        if (!flush()) {
             break;
         }
+        if (drained()) {
+            if (!moved_replays.empty() && published >= moved_replays.back().first) {
+                moved_replays.clear(); // no live duplicate of a replayed event is left
+            }
+            advance(published);
+        }
     }
 
     // cleanup callback
-    remove_callback(actor, cb_id);
+    plan.detach(sub_id);
+    ring->Close();
+    unregister_stream(stream_id);
 
-    return Status::OK;
+    return status;
+}
+
+uint64_t IquoraServiceImpl::register_stream(std::shared_ptr<EventRing> ring) {
+    std::lock_guard<std::mutex> lock(streams_mutex_);
+    const uint64_t id = next_stream_id_++;
+    streams_.emplace(id, std::move(ring));
+    return id;
+}
+
+void IquoraServiceImpl::unregister_stream(uint64_t stream_id) {
+    std::lock_guard<std::mutex> lock(streams_mutex_);
+    auto it = streams_.find(stream_id);
+    if (it == streams_.end()) return;
+    // Keep the totals of finished streams in the metrics
+    closed_dropped_ += it->second->GetDroppedCount();
+    closed_conflated_ += it->second->GetConflatedCount();
+    streams_.erase(it);
+}
+
+IquoraServiceImpl::SubscriptionStats IquoraServiceImpl::subscription_stats() const {
+    SubscriptionStats stats;
+    std::lock_guard<std::mutex> lock(streams_mutex_);
+    stats.streams = streams_.size();
+    stats.dropped = closed_dropped_;
+    stats.conflated = closed_conflated_;
+    stats.disconnects = disconnects_.load();
+    for (const auto& [id, ring] : streams_) {
+        const size_t depth = ring->Size();
+        stats.queued += depth;
+        stats.max_depth = std::max<uint64_t>(stats.max_depth, depth);
+        stats.dropped += ring->GetDroppedCount();
+        stats.conflated += ring->GetConflatedCount();
+    }
+    return stats;
 }
 
 Status IquoraServiceImpl::SpawnActor(ServerContext* context,
                                         const iquora::SpawnActorRequest* req,
                                         iquora::SpawnActorResponse* res) {
+    if (Status held = wait_ready(context); !held.ok()) {
+        return held;
+    }
     // Convert protobuf map to unordered_map
     std::unordered_map<std::string, std::string> initial_state;
     for (const auto& [key, value] : req->initial_state()) {
@@ -209,6 +720,9 @@ Status IquoraServiceImpl::SpawnActor(ServerContext* context,
 Status IquoraServiceImpl::TerminateActor(ServerContext* context,
                                             const iquora::TerminateActorRequest* request,
                                             iquora::TerminateActorResponse* response) {
+    if (Status held = wait_ready(context); !held.ok()) {
+        return held;
+    }
     bool success = lifecycle_->TerminateActor(request->actor_id(), request->force());
     response->set_success(success);
     
@@ -217,4 +731,36 @@ Status IquoraServiceImpl::TerminateActor(ServerContext* context,
     }
     
     return Status::OK;
-}
\ No newline at end of file
+}
+
+Status IquoraServiceImpl::TailLog(ServerContext* context,
+                                    const iquora::TailLogRequest* req,
+                                    ServerWriter<iquora::TailLogResponse>* writer) {
+    if (Status held = wait_ready(context); !held.ok()) {
+        return held;
+    }
+    const size_t max_batch = req->max_batch() > 0 ? req->max_batch() : 512;
+    WALCursor cursor(*wal_, req->from_seq());
+    std::vector<WALCursor::EntryView> batch;
+
+    while (!context->IsCancelled()) {
+        if (cursor.next_batch(batch, max_batch, std::chrono::milliseconds(500)) == 0) {
+            continue; // timed out, check cancellation again
+        }
+
+        iquora::TailLogResponse resp;
+        for (const auto& view : batch) {
+            auto* entry = resp.add_entries();
+            entry->set_seq_no(view.seq_no);
+            entry->set_timestamp(view.timestamp);
+            entry->set_actor_id(view.actor_id.data(), view.actor_id.size());
+            entry->set_key(view.key.data(), view.key.size());
+            entry->set_value(view.value.data(), view.value.size());
+            entry->set_deleted(view.op == WAL::Op::Delete);
+        }
+        if (!writer->Write(resp)) {
+            break;
+        }
+    }
+    return Status::OK;
+}
@@ -4,18 +4,19 @@
 #include <unordered_map>
 #include <functional>
 #include <mutex>
+#include <condition_variable>
 
 #include <grpcpp/grpcpp.h>
 #include "proto/iquora.grpc.pb.h"
 
 #include "mem_store.h"
 #include "wal.h"
+#include "wal_cursor.h"
 #include "write_behind_worker.h"
 #include "actor_lifecycle.h"
 
 // Your utility containers
-#include "utils/threadsafe_queue.h"
-#include "utils/threadsafe_list.h"
+#include "utils/ring_buffer.h"
 #include "utils/thread_pool.h"
 
 using grpc::ServerContext;
@@ -26,14 +27,14 @@ class IquoraServiceImpl final : public iquora::StateStore::Service {
 public:
     // Factory function for easy creation
     static std::shared_ptr<IquoraServiceImpl> Create(
-        std::shared_ptr<MemStore> memstore = nullptr,
+        std::shared_ptr<IStore> store = nullptr,
         std::shared_ptr<WAL> wal = nullptr,
         std::shared_ptr<WriteBehindWorker> wb = nullptr,
         std::shared_ptr<ActorLifecycle> lifecycle = nullptr,
         std::shared_ptr<ThreadPool<>> pool = nullptr);
 
     // Constructor
-    IquoraServiceImpl(std::shared_ptr<MemStore> memstore,
+    IquoraServiceImpl(std::shared_ptr<IStore> store,
                       std::shared_ptr<WAL> wal,
                       std::shared_ptr<WriteBehindWorker> wb,
                       std::shared_ptr<ActorLifecycle> lifecycle,
@@ -48,9 +49,24 @@ public:
                 const iquora::SetRequest* req,
                 iquora::SetResponse* resp) override;
 
-    Status Subscribe(ServerContext* context, 
-                        const iquora::SubscribeRequest* req,
-                        ServerWriter<iquora::SubscribeResponse>* writer) override;
+    // Subscribe and SubscribeBatched are served as split streams writing
+    // pre-encoded events; see the constructor
+    using RawEventStream = grpc::ServerSplitStreamer<iquora::SubscribeRequest, grpc::ByteBuffer>;
+    Status StreamedSubscribe(ServerContext* context, RawEventStream* stream);
+
+    // Same events as Subscribe, packed into batches: up to max_batch events
+    // per message, none held back longer than max_latency_ms
+    Status StreamedSubscribeBatched(ServerContext* context, RawEventStream* stream);
+
+    // Changes of every actor from the store's change feed, batched like
+    // SubscribeBatched; see ChangeFeedRequest for partitions and groups
+    using RawFeedStream = grpc::ServerSplitStreamer<iquora::ChangeFeedRequest, grpc::ByteBuffer>;
+    Status StreamedSubscribeAll(ServerContext* context, RawFeedStream* stream);
+
+    // Many actors' subscriptions multiplexed on one bidirectional stream;
+    // watches are added and removed while events flow
+    using RawWatchStream = grpc::ServerReaderWriter<grpc::ByteBuffer, iquora::WatchRequest>;
+    Status StreamedWatch(ServerContext* context, RawWatchStream* stream);
 
     Status SpawnActor(ServerContext* context,
                         const iquora::SpawnActorRequest* req,
@@ -60,61 +76,92 @@ public:
                               const iquora::TerminateActorRequest* req,
                               iquora::TerminateActorResponse* res) override;
 
-    // programmatic helpers
-    void publish_change(const std::string& actor_id,
-                        const std::string& key,
-                        const std::string& value,
-                        const std::string& event_type);
-
-private:
-    // subscription callback signature
-    using SubCallback = std::function<void(const iquora::SubscribeResponse&)>;
-
-    // Callback wrapper with ID for removal
-    struct CallbackWrapper {
-        size_t id;
-        SubCallback callback;
-        
-        CallbackWrapper(size_t id, SubCallback cb) : id(id), callback(std::move(cb)) {}
+    Status TailLog(ServerContext* context,
+                    const iquora::TailLogRequest* req,
+                    ServerWriter<iquora::TailLogResponse>* writer) override;
+
+    // Subscription stream buffers, summed over the open streams; dropped and
+    // conflated also count streams that have ended
+    struct SubscriptionStats {
+        uint64_t streams = 0;
+        uint64_t queued = 0;      // events buffered, not yet written
+        uint64_t max_depth = 0;   // fullest single buffer
+        uint64_t dropped = 0;     // discarded by DropOldest (and Conflate when full)
+        uint64_t conflated = 0;   // replaced by a newer value for the same key
+        uint64_t disconnects = 0; // streams closed by the Disconnect policy
     };
+    SubscriptionStats subscription_stats() const;
 
-    // A small subscription manager using a threadsafe map + threadsafe_list of callbacks
-    struct SubscriptionList {
-        ThreadSafeList<CallbackWrapper> callbacks; // list of callbacks for an actor
-
-        std::atomic<size_t> next_id_{1};
-        
-        size_t add(SubCallback callback) {
-            size_t id = next_id_.fetch_add(1);
-            callbacks.push_front(CallbackWrapper(id, std::move(callback)));
-            return id;
-        }
-        
-        bool remove(size_t id) {
-            return callbacks.remove_first_if([id](const CallbackWrapper& wrapper) {
-                return wrapper.id == id;
-            });
-        }
-        
-        size_t size() const {
-            return callbacks.size();
-        }
-    };
-
-    // find-or-create subscription list for actor
-    std::shared_ptr<SubscriptionList> get_or_create_subs(const std::string& actor_id);
-
-    // remove callback by id
-    void remove_callback(const std::string& actor_id, size_t cb_id);
+    // While held, every call waits before touching the store. Lets the port be
+    // bound (and connections queue here) before recovery or a warm restart
+    // handoff has finished.
+    void hold_requests();
+    void release_requests();
 
 private:
-    std::shared_ptr<MemStore> memstore_;
+    using EventRing = RingBuffer<SubscriptionSystem::EventPtr>;
+    static constexpr size_t kDefaultStreamBuffer = 1024;
+    static constexpr size_t kMaxStreamBuffer = 65536;
+    static constexpr size_t kPopBatch = 64;          // events taken from a ring at a time
+    static constexpr size_t kDefaultMaxBatch = 256;
+    static constexpr uint32_t kDefaultMaxLatencyMs = 10;
+
+    // Writes a batch of events to the client; false once the stream is gone
+    using SendBatch = std::function<bool(const std::vector<SubscriptionSystem::EventPtr>&)>;
+    // The event as a serialised SubscribeResponse, encoded on first use
+    static const grpc::Slice& encoded(const ChangeEvent& event);
+    // What a subscription stream serves: its buffer, its batching, where its
+    // live events come from and which logged changes a resume replays
+    struct StreamPlan {
+        iquora::SlowConsumerPolicy policy = iquora::DROP_OLDEST;
+        uint32_t buffer_size = 0;       // 0 = kDefaultStreamBuffer
+        uint64_t resume_from_seq = 0;
+        size_t max_batch = kPopBatch;
+        std::chrono::milliseconds max_latency{0};
+        using Replays = std::function<bool(const WALCursor::EntryView&)>;
+        // Returns the subscription id; delivered_seq is what the client already has
+        std::function<uint64_t(SubscriptionSystem::SubCallback, uint64_t delivered_seq)> attach;
+        std::function<void(uint64_t)> detach;
+        Replays replays;
+        // Consumer groups only. acknowledge reports how far the stream has sent;
+        // take_moves returns the partitions moved to it since the last call as
+        // the seq_no to replay from and the logged changes that belong to them.
+        struct Moved {
+            uint64_t from_seq = 0;
+            Replays replays; // empty: nothing moved
+        };
+        std::function<void(uint64_t, uint64_t)> acknowledge;
+        std::function<Moved(uint64_t)> take_moves;
+    };
+    // Subscribe and SubscribeBatched: one actor's changes
+    Status serve_subscription(ServerContext* context, const iquora::SubscribeRequest& req,
+                              size_t max_batch, std::chrono::milliseconds max_latency,
+                              const SendBatch& send);
+    // Replay, then live delivery from the ring
+    Status serve_stream(ServerContext* context, const StreamPlan& plan, const SendBatch& send);
+    // Writes events as SubscribeBatchResponse messages
+    static SendBatch batch_writer(grpc::internal::WriterInterface<grpc::ByteBuffer>* stream);
+
+    // Returns once requests are released, or UNAVAILABLE if the call is cancelled first
+    Status wait_ready(ServerContext* context);
+    uint64_t register_stream(std::shared_ptr<EventRing> ring);
+    void unregister_stream(uint64_t stream_id);
+
+    std::shared_ptr<IStore> store_;
     std::shared_ptr<WAL> wal_;
     std::shared_ptr<WriteBehindWorker> writebehind_;
     std::shared_ptr<ActorLifecycle> lifecycle_;
     std::shared_ptr<ThreadPool<>> pool_;
 
-    // actor_id -> SubscriptionList
-    std::mutex subs_map_mutex_;
-    std::unordered_map<std::string, std::shared_ptr<SubscriptionList>> subs_map_;
+    std::mutex ready_mutex_;
+    std::condition_variable ready_cv_;
+    bool ready_ = true;
+
+    // Open subscription streams, for metrics
+    mutable std::mutex streams_mutex_;
+    std::unordered_map<uint64_t, std::shared_ptr<EventRing>> streams_;
+    uint64_t next_stream_id_ = 1;
+    uint64_t closed_dropped_ = 0;
+    uint64_t closed_conflated_ = 0;
+    std::atomic<uint64_t> disconnects_{0};
 };
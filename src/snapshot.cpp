@@ -0,0 +1,220 @@
+#include "snapshot.h"
+#include "utils/binary_io.h"
+#include "utils/durable_file.h"
+#include "utils/mapped_file.h"
+#include "utils/rate_limiter.h"
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace {
+constexpr char kMagic[8] = {'I', 'Q', 'S', 'N', 'A', 'P', '0', '1'};
+constexpr size_t kHeaderSize = sizeof(kMagic) + 8 + 4;
+}
+
+SnapshotWriter::SnapshotWriter(const std::string& path, uint64_t wal_seq, uint32_t flags,
+                               size_t block_size)
+    : path_(path), tmp_path_(path + ".tmp"), block_size_(block_size) {
+    auto dir = std::filesystem::path(path).parent_path();
+    if (!dir.empty()) {
+        std::filesystem::create_directories(dir);
+    }
+    fd_ = ::open(tmp_path_.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd_ < 0) {
+        throw std::runtime_error("Failed to create snapshot file: " + tmp_path_);
+    }
+    std::string header(kMagic, sizeof(kMagic));
+    binary_io::put_fixed64(header, wal_seq);
+    binary_io::put_fixed32(header, flags);
+    write_all(header);
+}
+
+SnapshotWriter::~SnapshotWriter() {
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+    if (!finished_) {
+        std::error_code ec;
+        std::filesystem::remove(tmp_path_, ec); // abandoned snapshot
+    }
+}
+
+void SnapshotWriter::add(const SnapshotRecord& record) {
+    size_t actor_shared = binary_io::shared_prefix(prev_actor_, record.actor_id);
+    size_t key_shared = binary_io::shared_prefix(prev_key_, record.key);
+
+    binary_io::put_varint(block_, record.actor_removed ? 1 : 0);
+    binary_io::put_varint(block_, actor_shared);
+    binary_io::put_bytes(block_, record.actor_id.substr(actor_shared));
+    binary_io::put_varint(block_, key_shared);
+    binary_io::put_bytes(block_, record.key.substr(key_shared));
+    binary_io::put_bytes(block_, record.value);
+    binary_io::put_varint(block_, record.version);
+    binary_io::put_varint(block_, record.created_at_ms);
+    binary_io::put_varint(block_, record.expires_at_ms);
+
+    prev_actor_.assign(record.actor_id.data(), record.actor_id.size());
+    prev_key_.assign(record.key.data(), record.key.size());
+    record_count_++;
+
+    if (block_.size() >= block_size_) {
+        flush_block();
+    }
+}
+
+void SnapshotWriter::flush_block() {
+    if (block_.empty()) {
+        return;
+    }
+    std::string frame;
+    binary_io::put_fixed32(frame, static_cast<uint32_t>(block_.size()));
+    binary_io::put_fixed32(frame, binary_io::crc32(block_));
+    if (limiter_) {
+        limiter_->acquire(frame.size() + block_.size());
+    }
+    write_all(frame);
+    write_all(block_);
+    block_.clear();
+    prev_actor_.clear();
+    prev_key_.clear();
+}
+
+void SnapshotWriter::finish() {
+    if (finished_) {
+        return;
+    }
+    flush_block();
+    std::string trailer;
+    binary_io::put_fixed32(trailer, 0);
+    binary_io::put_fixed64(trailer, record_count_);
+    write_all(trailer);
+
+    if (::fsync(fd_) != 0) {
+        throw std::runtime_error("Failed to sync snapshot: " + std::string(strerror(errno)));
+    }
+    ::close(fd_);
+    fd_ = -1;
+    std::filesystem::rename(tmp_path_, path_);
+    finished_ = true;
+}
+
+void SnapshotWriter::write_all(const std::string& data) {
+    size_t written = 0;
+    while (written < data.size()) {
+        ssize_t n = ::write(fd_, data.data() + written, data.size() - written);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            throw std::runtime_error("Failed to write snapshot: " + std::string(strerror(errno)));
+        }
+        written += static_cast<size_t>(n);
+    }
+    bytes_written_ += data.size();
+}
+
+SnapshotReader::SnapshotReader(const std::string& path) : path_(path) {
+    MappedFile file(path);
+    std::string_view in = file.view();
+    if (in.size() < kHeaderSize || in.compare(0, sizeof(kMagic), std::string_view(kMagic, sizeof(kMagic))) != 0) {
+        throw std::runtime_error("Not a snapshot file: " + path);
+    }
+    in.remove_prefix(sizeof(kMagic));
+    binary_io::get_fixed64(in, wal_seq_);
+    binary_io::get_fixed32(in, flags_);
+}
+
+uint64_t SnapshotReader::for_each(const RecordHandler& handler) const {
+    MappedFile file(path_);
+    file.advise_sequential();
+    std::string_view in = file.view().substr(kHeaderSize);
+    auto corrupt = [this](const char* what) {
+        return std::runtime_error("Corrupt snapshot " + path_ + ": " + what);
+    };
+
+    std::string actor, key;
+    uint64_t delivered = 0;
+    while (true) {
+        uint32_t len, crc;
+        if (!binary_io::get_fixed32(in, len)) throw corrupt("truncated block header");
+        if (len == 0) {
+            uint64_t expected;
+            if (!binary_io::get_fixed64(in, expected)) throw corrupt("truncated trailer");
+            if (expected != delivered) throw corrupt("record count mismatch");
+            return delivered;
+        }
+        if (!binary_io::get_fixed32(in, crc) || in.size() < len) throw corrupt("truncated block");
+        std::string_view block = in.substr(0, len);
+        in.remove_prefix(len);
+        if (binary_io::crc32(block) != crc) throw corrupt("block checksum mismatch");
+
+        actor.clear();
+        key.clear();
+        while (!block.empty()) {
+            uint64_t flags, actor_shared, key_shared;
+            std::string_view actor_tail, key_tail;
+            SnapshotRecord record;
+            if (!binary_io::get_varint(block, flags) ||
+                !binary_io::get_varint(block, actor_shared) ||
+                !binary_io::get_bytes(block, actor_tail) ||
+                !binary_io::get_varint(block, key_shared) ||
+                !binary_io::get_bytes(block, key_tail) ||
+                !binary_io::get_bytes(block, record.value) ||
+                !binary_io::get_varint(block, record.version) ||
+                !binary_io::get_varint(block, record.created_at_ms) ||
+                !binary_io::get_varint(block, record.expires_at_ms) ||
+                actor_shared > actor.size() || key_shared > key.size()) {
+                throw corrupt("malformed record");
+            }
+            actor.resize(actor_shared);
+            actor.append(actor_tail.data(), actor_tail.size());
+            key.resize(key_shared);
+            key.append(key_tail.data(), key_tail.size());
+
+            record.actor_id = actor;
+            record.key = key;
+            record.actor_removed = (flags & 1) != 0;
+            handler(record);
+            delivered++;
+        }
+    }
+}
+
+void SnapshotManifest::write(const std::string& path) const {
+    // Synced before returning: the previous set's files are deleted once it is in place
+    std::ostringstream out;
+    out << "IQSNAPSET 1\n";
+    out << "wal_seq " << wal_seq << "\n";
+    for (const auto& file : files) {
+        out << "shard " << file << "\n";
+    }
+    durable_file::write_atomically(path, out.str());
+}
+
+SnapshotManifest SnapshotManifest::read(const std::string& path) {
+    std::ifstream in(path);
+    std::string line;
+    if (!in || !getline(in, line) || line != "IQSNAPSET 1") {
+        throw std::runtime_error("Not a snapshot manifest: " + path);
+    }
+    SnapshotManifest manifest;
+    bool have_seq = false;
+    while (getline(in, line)) {
+        std::istringstream fields(line);
+        std::string kind, value;
+        if (!(fields >> kind >> value)) continue;
+        if (kind == "wal_seq") {
+            manifest.wal_seq = std::stoull(value);
+            have_seq = true;
+        } else if (kind == "shard") {
+            manifest.files.push_back(value);
+        }
+    }
+    if (!have_seq || manifest.files.empty()) {
+        throw std::runtime_error("Incomplete snapshot manifest: " + path);
+    }
+    return manifest;
+}
@@ -0,0 +1,227 @@
+#include "snapshot_image.h"
+#include "utils/binary_io.h"
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace {
+constexpr char kMagic[8] = {'I', 'Q', 'I', 'M', 'G', '0', '0', '1'};
+constexpr size_t kHeaderSize = sizeof(kMagic) + 6 * 8;
+constexpr size_t kKeyEntrySize = 48;
+constexpr size_t kActorEntrySize = 24;
+constexpr size_t kHeapChunk = 1 << 20;
+}
+
+SnapshotImageWriter::SnapshotImageWriter(const std::string& path, uint64_t wal_seq)
+    : path_(path), tmp_path_(path + ".tmp"), wal_seq_(wal_seq) {
+    auto dir = std::filesystem::path(path).parent_path();
+    if (!dir.empty()) {
+        std::filesystem::create_directories(dir);
+    }
+    fd_ = ::open(tmp_path_.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd_ < 0) {
+        throw std::runtime_error("Failed to create snapshot image: " + tmp_path_);
+    }
+    write_all(std::string(kHeaderSize, '\0')); // filled in by finish()
+}
+
+SnapshotImageWriter::~SnapshotImageWriter() {
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+    if (!finished_) {
+        std::error_code ec;
+        std::filesystem::remove(tmp_path_, ec);
+    }
+}
+
+uint64_t SnapshotImageWriter::append_heap(std::string_view bytes) {
+    uint64_t offset = heap_size_;
+    heap_.append(bytes.data(), bytes.size());
+    heap_size_ += bytes.size();
+    if (heap_.size() >= kHeapChunk) {
+        write_all(heap_);
+        heap_.clear();
+    }
+    return offset;
+}
+
+void SnapshotImageWriter::begin_actor(std::string_view actor_id) {
+    end_actor();
+    binary_io::put_fixed64(actors_, append_heap(actor_id));
+    binary_io::put_fixed32(actors_, static_cast<uint32_t>(actor_id.size()));
+    // key_count is patched in by end_actor()
+    binary_io::put_fixed32(actors_, 0);
+    binary_io::put_fixed64(actors_, key_count_);
+    actor_count_++;
+}
+
+void SnapshotImageWriter::end_actor() {
+    if (actor_count_ == 0) {
+        return;
+    }
+    std::string count;
+    binary_io::put_fixed32(count, current_keys_);
+    actors_.replace(actors_.size() - kActorEntrySize + 12, 4, count);
+    current_keys_ = 0;
+}
+
+void SnapshotImageWriter::add(std::string_view key, std::string_view value, uint64_t version,
+                              uint64_t created_at_ms, uint64_t expires_at_ms) {
+    uint64_t key_off = append_heap(key);
+    uint64_t value_off = append_heap(value);
+    binary_io::put_fixed64(keys_, key_off);
+    binary_io::put_fixed32(keys_, static_cast<uint32_t>(key.size()));
+    binary_io::put_fixed32(keys_, static_cast<uint32_t>(value.size()));
+    binary_io::put_fixed64(keys_, value_off);
+    binary_io::put_fixed64(keys_, version);
+    binary_io::put_fixed64(keys_, created_at_ms);
+    binary_io::put_fixed64(keys_, expires_at_ms);
+    key_count_++;
+    current_keys_++;
+}
+
+void SnapshotImageWriter::finish() {
+    if (finished_) {
+        return;
+    }
+    end_actor();
+    write_all(heap_);
+    heap_.clear();
+    write_all(keys_);
+    write_all(actors_);
+
+    std::string header(kMagic, sizeof(kMagic));
+    binary_io::put_fixed64(header, wal_seq_);
+    binary_io::put_fixed64(header, actor_count_);
+    binary_io::put_fixed64(header, key_count_);
+    binary_io::put_fixed64(header, kHeaderSize);
+    binary_io::put_fixed64(header, kHeaderSize + heap_size_);
+    binary_io::put_fixed64(header, kHeaderSize + heap_size_ + keys_.size());
+    if (::pwrite(fd_, header.data(), header.size(), 0) != static_cast<ssize_t>(header.size())) {
+        throw std::runtime_error("Failed to write snapshot image header: " + std::string(strerror(errno)));
+    }
+
+    if (::fsync(fd_) != 0) {
+        throw std::runtime_error("Failed to sync snapshot image: " + std::string(strerror(errno)));
+    }
+    ::close(fd_);
+    fd_ = -1;
+    std::filesystem::rename(tmp_path_, path_);
+    finished_ = true;
+}
+
+void SnapshotImageWriter::write_all(const std::string& data) {
+    size_t written = 0;
+    while (written < data.size()) {
+        ssize_t n = ::write(fd_, data.data() + written, data.size() - written);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            throw std::runtime_error("Failed to write snapshot image: " + std::string(strerror(errno)));
+        }
+        written += static_cast<size_t>(n);
+    }
+}
+
+SnapshotImage::SnapshotImage(const std::string& path) : file_(path) {
+    std::string_view in = file_.view();
+    if (in.size() < kHeaderSize || in.compare(0, sizeof(kMagic), std::string_view(kMagic, sizeof(kMagic))) != 0) {
+        throw std::runtime_error("Not a snapshot image: " + path);
+    }
+    in.remove_prefix(sizeof(kMagic));
+    uint64_t actor_count, heap_offset, keys_offset, actors_offset;
+    binary_io::get_fixed64(in, wal_seq_);
+    binary_io::get_fixed64(in, actor_count);
+    binary_io::get_fixed64(in, key_count_);
+    binary_io::get_fixed64(in, heap_offset);
+    binary_io::get_fixed64(in, keys_offset);
+    binary_io::get_fixed64(in, actors_offset);
+
+    // Only the section bounds are checked here; entries are read on demand
+    const uint64_t size = file_.size();
+    if (heap_offset > keys_offset || keys_offset > actors_offset ||
+        actors_offset - keys_offset != key_count_ * kKeyEntrySize ||
+        actors_offset + actor_count * kActorEntrySize != size) {
+        throw std::runtime_error("Corrupt snapshot image: " + path);
+    }
+    actor_count_ = static_cast<size_t>(actor_count);
+    heap_ = file_.data() + heap_offset;
+    heap_size_ = keys_offset - heap_offset;
+    keys_ = file_.data() + keys_offset;
+    actors_ = file_.data() + actors_offset;
+    file_.advise_random();
+}
+
+std::string_view SnapshotImage::heap_view(uint64_t offset, uint64_t length) const {
+    if (offset > heap_size_ || length > heap_size_ - offset) {
+        throw std::runtime_error("Corrupt snapshot image: heap reference out of range");
+    }
+    return {heap_ + offset, static_cast<size_t>(length)};
+}
+
+std::string_view SnapshotImage::actor_at(size_t index) const {
+    const char* entry = actors_ + index * kActorEntrySize;
+    return heap_view(binary_io::load_fixed64(entry), binary_io::load_fixed32(entry + 8));
+}
+
+std::string_view SnapshotImage::key_at(uint64_t index) const {
+    const char* entry = keys_ + index * kKeyEntrySize;
+    return heap_view(binary_io::load_fixed64(entry), binary_io::load_fixed32(entry + 8));
+}
+
+SnapshotImage::Value SnapshotImage::value_at(uint64_t index) const {
+    const char* entry = keys_ + index * kKeyEntrySize;
+    Value value;
+    value.value = heap_view(binary_io::load_fixed64(entry + 16), binary_io::load_fixed32(entry + 12));
+    value.version = binary_io::load_fixed64(entry + 24);
+    value.created_at_ms = binary_io::load_fixed64(entry + 32);
+    value.expires_at_ms = binary_io::load_fixed64(entry + 40);
+    return value;
+}
+
+std::optional<size_t> SnapshotImage::find_actor(std::string_view actor_id) const {
+    size_t lo = 0, hi = actor_count_;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        int cmp = actor_at(mid).compare(actor_id);
+        if (cmp == 0) return mid;
+        if (cmp < 0) lo = mid + 1;
+        else hi = mid;
+    }
+    return std::nullopt;
+}
+
+std::optional<SnapshotImage::Value> SnapshotImage::find(std::string_view actor_id, std::string_view key) const {
+    auto actor = find_actor(actor_id);
+    if (!actor) return std::nullopt;
+
+    const char* entry = actors_ + *actor * kActorEntrySize;
+    uint64_t lo = binary_io::load_fixed64(entry + 16);
+    uint64_t hi = lo + binary_io::load_fixed32(entry + 12);
+    if (hi > key_count_) {
+        throw std::runtime_error("Corrupt snapshot image: key range out of bounds");
+    }
+    while (lo < hi) {
+        uint64_t mid = lo + (hi - lo) / 2;
+        int cmp = key_at(mid).compare(key);
+        if (cmp == 0) return value_at(mid);
+        if (cmp < 0) lo = mid + 1;
+        else hi = mid;
+    }
+    return std::nullopt;
+}
+
+void SnapshotImage::for_each_key(size_t actor_index, const KeyHandler& handler) const {
+    const char* entry = actors_ + actor_index * kActorEntrySize;
+    uint64_t first = binary_io::load_fixed64(entry + 16);
+    uint64_t last = first + binary_io::load_fixed32(entry + 12);
+    if (last > key_count_) {
+        throw std::runtime_error("Corrupt snapshot image: key range out of bounds");
+    }
+    for (uint64_t i = first; i < last; ++i) {
+        handler(key_at(i), value_at(i));
+    }
+}
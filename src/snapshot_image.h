@@ -0,0 +1,96 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <optional>
+#include <functional>
+#include <cstdint>
+#include "utils/mapped_file.h"
+
+// Snapshot layout that is served in place from a read-only mapping instead of
+// being loaded into hash maps. Every table has fixed-width entries, so lookups
+// are binary searches straight over the mapped pages and only the pages that
+// are actually touched are ever read from disk.
+//
+//   header:    "IQIMG001" | fixed64 wal_seq | fixed64 actor_count | fixed64 key_count
+//              | fixed64 heap_offset | fixed64 keys_offset | fixed64 actors_offset
+//   heap:      actor ids, keys and values, back to back
+//   keys:      per actor, sorted by key:
+//              fixed64 key_off | fixed32 key_len | fixed32 value_len | fixed64 value_off
+//              | fixed64 version | fixed64 created_ms | fixed64 expires_ms (0 = no TTL)
+//   actors:    sorted by actor id:
+//              fixed64 name_off | fixed32 name_len | fixed32 key_count | fixed64 first_key
+//
+// Heap offsets are relative to heap_offset.
+class SnapshotImageWriter
+{
+public:
+    // Writes to path + ".tmp"; finish() syncs it and renames it into place.
+    SnapshotImageWriter(const std::string& path, uint64_t wal_seq);
+    ~SnapshotImageWriter();
+
+    SnapshotImageWriter(const SnapshotImageWriter&) = delete;
+    SnapshotImageWriter& operator=(const SnapshotImageWriter&) = delete;
+
+    // Actors must be added in ascending order, and keys in ascending order within an actor.
+    void begin_actor(std::string_view actor_id);
+    void add(std::string_view key, std::string_view value, uint64_t version,
+             uint64_t created_at_ms, uint64_t expires_at_ms);
+    void finish();
+
+private:
+    std::string path_;
+    std::string tmp_path_;
+    int fd_ = -1;
+    uint64_t wal_seq_;
+    std::string heap_;      // pending heap bytes, flushed in chunks
+    uint64_t heap_size_ = 0;
+    std::string keys_;
+    std::string actors_;
+    uint64_t actor_count_ = 0;
+    uint64_t key_count_ = 0;
+    uint32_t current_keys_ = 0;
+    bool finished_ = false;
+
+    uint64_t append_heap(std::string_view bytes);
+    void end_actor();
+    void write_all(const std::string& data);
+};
+
+class SnapshotImage
+{
+public:
+    struct Value {
+        std::string_view value;
+        uint64_t version = 0;
+        uint64_t created_at_ms = 0;
+        uint64_t expires_at_ms = 0;
+    };
+    using KeyHandler = std::function<void(std::string_view key, const Value& value)>;
+
+    // Maps the file and checks the header; nothing else is read up front.
+    explicit SnapshotImage(const std::string& path);
+
+    uint64_t wal_seq() const { return wal_seq_; }
+    size_t actor_count() const { return actor_count_; }
+    uint64_t key_count() const { return key_count_; }
+
+    std::string_view actor_at(size_t index) const;
+    std::optional<size_t> find_actor(std::string_view actor_id) const;
+    std::optional<Value> find(std::string_view actor_id, std::string_view key) const;
+    // Visits an actor's keys in ascending order.
+    void for_each_key(size_t actor_index, const KeyHandler& handler) const;
+
+private:
+    MappedFile file_;
+    uint64_t wal_seq_ = 0;
+    size_t actor_count_ = 0;
+    uint64_t key_count_ = 0;
+    const char* heap_ = nullptr;
+    uint64_t heap_size_ = 0;
+    const char* keys_ = nullptr;
+    const char* actors_ = nullptr;
+
+    std::string_view heap_view(uint64_t offset, uint64_t length) const;
+    std::string_view key_at(uint64_t index) const;
+    Value value_at(uint64_t index) const;
+};
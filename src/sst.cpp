@@ -0,0 +1,301 @@
+#include "sst.h"
+#include "utils/binary_io.h"
+#include "utils/bloom_filter.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+namespace {
+constexpr uint64_t kMagic = 0x3130545353515149ull; // "IQSST01"
+constexpr size_t kFooterSize = 7 * 8;
+
+// Reads one entry of a data block, resolving the prefix against key.
+bool next_entry(std::string_view& block, std::string& key, std::string_view& value) {
+    uint64_t shared, unshared, value_len;
+    if (!binary_io::get_varint(block, shared) || !binary_io::get_varint(block, unshared) ||
+        !binary_io::get_varint(block, value_len) || shared > key.size() ||
+        block.size() < unshared + value_len) {
+        return false;
+    }
+    key.resize(shared);
+    key.append(block.data(), unshared);
+    value = block.substr(unshared, value_len);
+    block.remove_prefix(unshared + value_len);
+    return true;
+}
+}
+
+std::atomic<uint64_t> SSTReader::bloom_skips_{0};
+
+SSTWriter::SSTWriter(const std::string& path, size_t block_size, size_t bits_per_key)
+    : path_(path), block_size_(block_size), filter_(bits_per_key) {
+    fd_ = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd_ < 0) {
+        throw std::runtime_error("Failed to create SST file: " + path);
+    }
+}
+
+SSTWriter::~SSTWriter() {
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+    if (!finished_) {
+        std::error_code ec;
+        std::filesystem::remove(path_, ec); // abandoned table
+    }
+}
+
+void SSTWriter::add(std::string_view key, std::string_view value, uint64_t seq) {
+    size_t shared = block_.empty() ? 0 : binary_io::shared_prefix(last_key_, key);
+    binary_io::put_varint(block_, shared);
+    binary_io::put_varint(block_, key.size() - shared);
+    binary_io::put_varint(block_, value.size());
+    block_.append(key.data() + shared, key.size() - shared);
+    block_.append(value.data(), value.size());
+
+    if (entries_ == 0) {
+        smallest_.assign(key.data(), key.size());
+    }
+    last_key_.assign(key.data(), key.size());
+    filter_.add(key);
+    max_seq_ = std::max(max_seq_, seq);
+    entries_++;
+
+    if (block_.size() >= block_size_) {
+        flush_block();
+    }
+}
+
+void SSTWriter::flush_block() {
+    if (block_.empty()) {
+        return;
+    }
+    uint64_t offset = write_block(block_);
+    index_.push_back(IndexEntry{last_key_, offset, block_.size()});
+    block_.clear();
+}
+
+uint64_t SSTWriter::write_block(const std::string& payload) {
+    uint64_t offset = offset_;
+    std::string crc;
+    binary_io::put_fixed32(crc, binary_io::crc32(payload));
+    write_all(payload);
+    write_all(crc);
+    return offset;
+}
+
+void SSTWriter::finish() {
+    if (finished_) {
+        return;
+    }
+    flush_block();
+
+    std::string index;
+    for (const auto& entry : index_) {
+        binary_io::put_bytes(index, entry.last_key);
+        binary_io::put_varint(index, entry.offset);
+        binary_io::put_varint(index, entry.size);
+    }
+    std::string filter = filter_.finish();
+    std::string props;
+    binary_io::put_bytes(props, smallest_);
+    binary_io::put_bytes(props, last_key_);
+    binary_io::put_varint(props, entries_);
+    binary_io::put_varint(props, max_seq_);
+
+    std::string footer;
+    binary_io::put_fixed64(footer, write_block(index));
+    binary_io::put_fixed64(footer, index.size());
+    binary_io::put_fixed64(footer, write_block(filter));
+    binary_io::put_fixed64(footer, filter.size());
+    binary_io::put_fixed64(footer, write_block(props));
+    binary_io::put_fixed64(footer, props.size());
+    binary_io::put_fixed64(footer, kMagic);
+    write_all(footer);
+
+    if (::fsync(fd_) != 0) {
+        throw std::runtime_error("Failed to sync SST file: " + std::string(strerror(errno)));
+    }
+    ::close(fd_);
+    fd_ = -1;
+    finished_ = true;
+}
+
+void SSTWriter::write_all(const std::string& data) {
+    size_t written = 0;
+    while (written < data.size()) {
+        ssize_t n = ::write(fd_, data.data() + written, data.size() - written);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            throw std::runtime_error("Failed to write SST file: " + std::string(strerror(errno)));
+        }
+        written += static_cast<size_t>(n);
+    }
+    offset_ += data.size();
+}
+
+SSTReader::SSTReader(const std::string& path, uint64_t file_no, std::shared_ptr<BlockCache> cache)
+    : path_(path), file_no_(file_no), cache_(std::move(cache)) {
+    fd_ = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    struct stat st;
+    if (fd_ < 0 || ::fstat(fd_, &st) != 0 || static_cast<uint64_t>(st.st_size) < kFooterSize) {
+        if (fd_ >= 0) ::close(fd_);
+        throw std::runtime_error("Not an SST file: " + path);
+    }
+    file_size_ = static_cast<uint64_t>(st.st_size);
+
+    auto read_checked = [&](uint64_t offset, uint64_t size) {
+        if (offset + size + 4 > file_size_) {
+            throw std::runtime_error("Corrupt SST file: " + path);
+        }
+        std::string block = read_raw(offset, size + 4);
+        if (binary_io::crc32(block.data(), size) != binary_io::load_fixed32(block.data() + size)) {
+            throw std::runtime_error("Corrupt SST file (checksum): " + path);
+        }
+        block.resize(size);
+        return block;
+    };
+
+    try {
+        std::string footer = read_raw(file_size_ - kFooterSize, kFooterSize);
+        uint64_t handles[6];
+        for (int i = 0; i < 6; ++i) {
+            handles[i] = binary_io::load_fixed64(footer.data() + 8 * i);
+        }
+        if (binary_io::load_fixed64(footer.data() + 48) != kMagic) {
+            throw std::runtime_error("Not an SST file: " + path);
+        }
+
+        std::string index = read_checked(handles[0], handles[1]);
+        filter_ = read_checked(handles[2], handles[3]);
+        std::string props = read_checked(handles[4], handles[5]);
+
+        std::string_view in = index;
+        while (!in.empty()) {
+            std::string_view last_key;
+            IndexEntry entry;
+            if (!binary_io::get_bytes(in, last_key) || !binary_io::get_varint(in, entry.offset) ||
+                !binary_io::get_varint(in, entry.size)) {
+                throw std::runtime_error("Corrupt SST index: " + path);
+            }
+            entry.last_key.assign(last_key.data(), last_key.size());
+            index_.push_back(std::move(entry));
+        }
+        std::string_view p = props, smallest, largest;
+        if (!binary_io::get_bytes(p, smallest) || !binary_io::get_bytes(p, largest) ||
+            !binary_io::get_varint(p, entries_) || !binary_io::get_varint(p, max_seq_)) {
+            throw std::runtime_error("Corrupt SST properties: " + path);
+        }
+        smallest_.assign(smallest.data(), smallest.size());
+        largest_.assign(largest.data(), largest.size());
+    } catch (...) {
+        ::close(fd_);
+        throw;
+    }
+}
+
+SSTReader::~SSTReader() {
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+    if (obsolete_) {
+        std::error_code ec;
+        std::filesystem::remove(path_, ec);
+    }
+}
+
+std::string SSTReader::read_raw(uint64_t offset, uint64_t size) const {
+    std::string data(size, '\0');
+    size_t done = 0;
+    while (done < size) {
+        ssize_t n = ::pread(fd_, data.data() + done, size - done, static_cast<off_t>(offset + done));
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) {
+            throw std::runtime_error("Failed to read SST file: " + path_);
+        }
+        done += static_cast<size_t>(n);
+    }
+    return data;
+}
+
+std::shared_ptr<const std::string> SSTReader::read_block(size_t index, bool fill_cache) const {
+    const uint64_t cache_key = (file_no_ << 24) ^ index;
+    std::shared_ptr<const std::string> block;
+    if (cache_ && cache_->get(cache_key, block)) {
+        return block;
+    }
+    const auto& handle = index_[index];
+    std::string data = read_raw(handle.offset, handle.size + 4);
+    if (binary_io::crc32(data.data(), handle.size) != binary_io::load_fixed32(data.data() + handle.size)) {
+        throw std::runtime_error("Corrupt SST block (checksum): " + path_);
+    }
+    data.resize(handle.size);
+    block = std::make_shared<const std::string>(std::move(data));
+    if (cache_ && fill_cache) {
+        cache_->put(cache_key, block, block->size());
+    }
+    return block;
+}
+
+bool SSTReader::get(std::string_view key, std::string& value) const {
+    if (key < smallest_ || key > largest_) {
+        return false;
+    }
+    if (!bloom::may_contain(filter_, key)) {
+        bloom_skips_++;
+        return false;
+    }
+    // First block whose last key is not below the key
+    auto it = std::lower_bound(index_.begin(), index_.end(), key,
+                               [](const IndexEntry& entry, std::string_view k) { return entry.last_key < k; });
+    if (it == index_.end()) {
+        return false;
+    }
+    auto block = read_block(static_cast<size_t>(it - index_.begin()), true);
+    std::string_view in = *block;
+    std::string current;
+    std::string_view current_value;
+    while (!in.empty()) {
+        if (!next_entry(in, current, current_value)) {
+            throw std::runtime_error("Corrupt SST block: " + path_);
+        }
+        int cmp = std::string_view(current).compare(key);
+        if (cmp == 0) {
+            value.assign(current_value.data(), current_value.size());
+            return true;
+        }
+        if (cmp > 0) break;
+    }
+    return false;
+}
+
+SSTReader::Iterator::Iterator(std::shared_ptr<const SSTReader> table) : table_(std::move(table)) {
+    valid_ = load_block();
+    if (valid_) next();
+}
+
+bool SSTReader::Iterator::load_block() {
+    while (block_index_ < table_->index_.size()) {
+        block_ = table_->read_block(block_index_++, false);
+        rest_ = *block_;
+        key_.clear();
+        if (!rest_.empty()) return true;
+    }
+    return false;
+}
+
+void SSTReader::Iterator::next() {
+    if (rest_.empty() && !load_block()) {
+        valid_ = false;
+        return;
+    }
+    if (!next_entry(rest_, key_, value_)) {
+        throw std::runtime_error("Corrupt SST block: " + table_->path_);
+    }
+    valid_ = true;
+}
@@ -0,0 +1,140 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <cstdint>
+#include "utils/lru_cache.h"
+#include "utils/bloom_filter.h"
+
+// Sorted string table: an immutable file of key/value pairs in key order,
+// read with pread so tables can be far larger than memory.
+//
+//   data blocks:  [varint shared | varint unshared | varint value_len | key tail | value]...
+//                 fixed32 crc32   (keys prefix-compressed within the block)
+//   index block:  [bytes last_key | varint offset | varint size]...  fixed32 crc32
+//   filter block: Bloom filter over all keys
+//   props block:  bytes smallest | bytes largest | varint entries | varint max_seq
+//   footer:       fixed64 offset, fixed64 size for index, filter and props | fixed64 magic
+//
+// Index, filter and props are loaded when a table is opened; data blocks are
+// read on demand and kept in a block cache shared by all tables.
+using BlockCache = LRUCache<uint64_t, std::shared_ptr<const std::string>>;
+
+class SSTWriter
+{
+public:
+    SSTWriter(const std::string& path, size_t block_size = 4096, size_t bits_per_key = 10);
+    ~SSTWriter();
+
+    SSTWriter(const SSTWriter&) = delete;
+    SSTWriter& operator=(const SSTWriter&) = delete;
+
+    // Keys must be added in strictly increasing order.
+    void add(std::string_view key, std::string_view value, uint64_t seq);
+    // Writes the index, filter, props and footer and syncs the file.
+    void finish();
+
+    uint64_t entry_count() const { return entries_; }
+    uint64_t file_size() const { return offset_; }
+
+private:
+    struct IndexEntry {
+        std::string last_key;
+        uint64_t offset;
+        uint64_t size;
+    };
+
+    std::string path_;
+    int fd_ = -1;
+    size_t block_size_;
+    std::string block_;
+    std::string last_key_;
+    std::string smallest_;
+    std::vector<IndexEntry> index_;
+    bloom::FilterBuilder filter_;
+    uint64_t offset_ = 0;
+    uint64_t entries_ = 0;
+    uint64_t max_seq_ = 0;
+    bool finished_ = false;
+
+    void flush_block();
+    // Writes payload + crc; returns the payload offset.
+    uint64_t write_block(const std::string& payload);
+    void write_all(const std::string& data);
+};
+
+class SSTReader
+{
+public:
+    // Throws if the file is missing or is not a table.
+    SSTReader(const std::string& path, uint64_t file_no, std::shared_ptr<BlockCache> cache);
+    ~SSTReader();
+
+    SSTReader(const SSTReader&) = delete;
+    SSTReader& operator=(const SSTReader&) = delete;
+
+    // Point lookup. Returns false without touching disk when the Bloom filter rules the key out.
+    bool get(std::string_view key, std::string& value) const;
+
+    const std::string& smallest() const { return smallest_; }
+    const std::string& largest() const { return largest_; }
+    uint64_t file_no() const { return file_no_; }
+    uint64_t file_size() const { return file_size_; }
+    uint64_t entry_count() const { return entries_; }
+    uint64_t max_seq() const { return max_seq_; }
+    const std::string& path() const { return path_; }
+
+    // The file is deleted once the last reference to the table is gone.
+    void mark_obsolete() { obsolete_ = true; }
+
+    static uint64_t bloom_skips() { return bloom_skips_.load(); }
+
+    // Forward scan over the whole table. Blocks are read directly, bypassing
+    // the cache, so compactions do not evict the hot set.
+    class Iterator
+    {
+    public:
+        explicit Iterator(std::shared_ptr<const SSTReader> table);
+        bool valid() const { return valid_; }
+        std::string_view key() const { return key_; }
+        std::string_view value() const { return value_; }
+        void next();
+
+    private:
+        std::shared_ptr<const SSTReader> table_;
+        size_t block_index_ = 0;
+        std::shared_ptr<const std::string> block_;
+        std::string_view rest_;
+        std::string key_;
+        std::string_view value_;
+        bool valid_ = false;
+
+        bool load_block();
+    };
+
+private:
+    struct IndexEntry {
+        std::string last_key;
+        uint64_t offset;
+        uint64_t size;
+    };
+
+    std::string path_;
+    uint64_t file_no_;
+    std::shared_ptr<BlockCache> cache_;
+    int fd_ = -1;
+    uint64_t file_size_ = 0;
+    std::vector<IndexEntry> index_;
+    std::string filter_;
+    std::string smallest_;
+    std::string largest_;
+    uint64_t entries_ = 0;
+    uint64_t max_seq_ = 0;
+    std::atomic<bool> obsolete_{false};
+    static std::atomic<uint64_t> bloom_skips_;
+
+    std::string read_raw(uint64_t offset, uint64_t size) const;
+    std::shared_ptr<const std::string> read_block(size_t index, bool fill_cache) const;
+};
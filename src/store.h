@@ -4,6 +4,8 @@
 #include <functional>
 #include <cstdint>
 #include <vector>
+#include <chrono>
+#include "pubsub.h"
 
 class IStore {
 public:
@@ -15,7 +17,8 @@ public:
         std::optional<uint64_t> expires_at; // unix timestamp (ms)
     };
 
-    using SubCallback = std::function<void(const std::string&, const std::string&, const std::string&)>;
+    // Receives the shared event; keep the pointer rather than copying it
+    using SubCallback = SubscriptionSystem::SubCallback;
 
     virtual ~IStore() = default;
 
@@ -30,9 +33,16 @@ public:
     virtual bool set_if_version(const std::string& actor_id, const std::string& key,
                                 const std::string& value, uint64_t expected_version) = 0;
 
-    // Pub/Sub
-    virtual uint64_t subscribe(const std::string& actor_id, SubCallback callback) = 0;
+    // Pub/Sub. With filters, only changes to matching keys are delivered.
+    virtual uint64_t subscribe(const std::string& actor_id, SubCallback callback,
+                               std::vector<KeyFilter> filters = {}) = 0;
     virtual bool unsubscribe(const std::string& actor_id, uint64_t sub_id) = 0;
+    // Every change across all actors, in partitions
+    virtual ChangeFeed& change_feed() = 0;
+    // Highest seq_no such that the change event of every logged write up to
+    // it has been handed to the subscribers. A stream that has sent all it was
+    // handed up to that point can resume from the next seq_no.
+    virtual uint64_t published_seq() const = 0;
 
     // Maintenance
     virtual void cleanup_expired() = 0;
@@ -40,4 +50,9 @@ public:
     // Persistence-related (optional)
     virtual void snapshot(const std::string& snapshot_path) = 0;
     virtual void recover_from_snapshot(const std::string& snapshot_path) = 0;
+
+    // Passivation (optional): stores holding every actor in memory can write
+    // idle ones out. Returns the ids of the actors written out.
+    virtual std::vector<std::string> passivate_idle(std::chrono::milliseconds /*idle_after*/) { return {}; }
+    virtual bool is_passivated(const std::string& /*actor_id*/) const { return false; }
 };
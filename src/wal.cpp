@@ -1,92 +1,708 @@
 #include "wal.h"
+#include "utils/common_utility.h"
+#include "utils/durable_file.h"
 #include<chrono>
+#include<iostream>
 #include<string>
 #include<iomanip>
 #include<fstream>
 #include<sstream>
 #include<filesystem>
+#include<queue>
+#include<algorithm>
+#include<charconv>
+#include <exception>
 #include <stdexcept>
-using std::ios; 
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+using std::ios;
 
-WAL::WAL(const std::string& path, size_t max_size_bytes) 
-        : path_(path), max_size_bytes_(max_size_bytes) {
-            open_log();
+namespace {
+// Writes all of data, retrying short writes. Returns false with errno set on failure.
+bool write_fully(int fd, const std::string& data) {
+    size_t written = 0;
+    while (written < data.size()) {
+        ssize_t n = ::write(fd, data.data() + written, data.size() - written);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        written += static_cast<size_t>(n);
+    }
+    return true;
+}
+}
+
+WAL::WAL(const std::string& path, size_t max_size_bytes, size_t num_streams)
+        : max_size_bytes_(max_size_bytes) {
+            init_streams(stream_paths_for(path, num_streams));
+        }
+
+WAL::WAL(const std::vector<std::string>& stream_paths, size_t max_size_bytes)
+        : max_size_bytes_(max_size_bytes) {
+            if (stream_paths.empty()) {
+                throw std::invalid_argument("WAL requires at least one stream path");
+            }
+            init_streams(stream_paths);
         }
 
 WAL::~WAL() {
-    if (wal_file_.is_open()) {
-        wal_file_.flush();
-        wal_file_.close();
+    for (auto& stream : streams_) {
+        std::lock_guard<std::mutex> io(stream->mutex);
+        close_log(*stream);
+    }
+}
+
+std::vector<std::string> WAL::stream_paths_for(const std::string& path, size_t num_streams) {
+    if (num_streams <= 1) {
+        return {path};
+    }
+    // wal.log -> wal-0.log, wal-1.log, ...
+    std::filesystem::path base(path);
+    std::vector<std::string> paths;
+    for (size_t i = 0; i < num_streams; ++i) {
+        auto name = base.stem().string() + "-" + std::to_string(i) + base.extension().string();
+        paths.push_back((base.parent_path() / name).string());
+    }
+    return paths;
+}
+
+void WAL::init_streams(const std::vector<std::string>& paths) {
+    streams_.clear();
+    for (const auto& path : paths) {
+        auto stream = std::make_unique<Stream>();
+        stream->index = streams_.size();
+        stream->path = path;
+        auto dir = std::filesystem::path(path).parent_path();
+        if (!dir.empty()) {
+            std::filesystem::create_directories(dir);
+        }
+        load_segments(*stream);
+        open_log(*stream);
+        streams_.push_back(std::move(stream));
+    }
+    committed_seq_ = seq_counter_.load();
+}
+
+void WAL::load_segments(Stream& stream) {
+    // Finds the first and last sequence number held by a log file
+    auto scan = [](const std::string& path, uint64_t& first, uint64_t& last) {
+        std::ifstream in(path);
+        std::string line;
+        EntryView view;
+        first = last = 0;
+        while (getline(in, line)) {
+            if (decode(line, view)) {
+                if (first == 0) first = view.seq_no;
+                last = view.seq_no;
+            }
+        }
+    };
+
+    std::filesystem::path active(stream.path);
+    auto dir = active.parent_path().empty() ? std::filesystem::path(".") : active.parent_path();
+    const std::string prefix = active.filename().string() + ".";
+
+    std::vector<std::pair<uint64_t, std::string>> numbered;
+    for (const auto& item : std::filesystem::directory_iterator(dir)) {
+        auto name = item.path().filename().string();
+        if (name.size() <= prefix.size() || name.compare(0, prefix.size(), prefix) != 0) continue;
+        auto suffix = name.substr(prefix.size());
+        if (!std::all_of(suffix.begin(), suffix.end(), ::isdigit)) continue;
+        numbered.emplace_back(std::stoull(suffix), (active.parent_path() / name).string());
+    }
+    std::sort(numbered.begin(), numbered.end());
+    if (!numbered.empty()) {
+        stream.next_segment_no = numbered.back().first + 1;
+    }
+
+    // The manifest is authoritative once it exists: compaction makes file numbers unordered
+    std::vector<std::string> sealed_paths;
+    const std::string manifest_path = stream.path + ".manifest";
+    if (std::filesystem::exists(manifest_path)) {
+        // A manifest always lists at least one segment, so an empty one is damage:
+        // falling back to the numbered files could resurrect compacted-away segments
+        std::ifstream manifest(manifest_path);
+        std::string name;
+        while (manifest && getline(manifest, name)) {
+            if (!name.empty()) sealed_paths.push_back((active.parent_path() / name).string());
+        }
+        if (!manifest.eof()) {
+            throw std::runtime_error("Failed to read WAL manifest: " + manifest_path);
+        }
+        if (sealed_paths.empty()) {
+            throw std::runtime_error("WAL manifest is empty: " + manifest_path);
+        }
+    } else {
+        for (const auto& [number, path] : numbered) {
+            sealed_paths.push_back(path);
+        }
+    }
+
+    uint64_t max_seq = 0;
+    for (const auto& path : sealed_paths) {
+        Segment segment{path, 0, 0, true};
+        scan(path, segment.first_seq, segment.last_seq);
+        max_seq = std::max(max_seq, segment.last_seq);
+        stream.sealed.push_back(segment);
     }
+    if (std::filesystem::exists(stream.path)) {
+        scan(stream.path, stream.first_seq, stream.last_seq);
+        max_seq = std::max(max_seq, stream.last_seq);
+    }
+
+    if (max_seq > seq_counter_.load()) {
+        seq_counter_.store(max_seq);
+    }
+}
+
+void WAL::write_manifest(const Stream& stream) {
+    // Synced before returning: replace_segments deletes what it no longer lists
+    std::string names;
+    for (const auto& segment : stream.sealed) {
+        names += std::filesystem::path(segment.path).filename().string();
+        names += "\n";
+    }
+    durable_file::write_atomically(stream.path + ".manifest", names);
 }
 
-void WAL::open_log() {
-    wal_file_.open(path_, ios::app);
-    if (!wal_file_) {
-        throw std::runtime_error("Failed to open WAL file: " + path_);
+void WAL::open_log(Stream& stream) {
+    stream.fd = ::open(stream.path.c_str(), O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC, 0644);
+    if (stream.fd < 0) {
+        throw std::runtime_error("Failed to open WAL file: " + stream.path + ": " + strerror(errno));
+    }
+}
+
+void WAL::close_log(Stream& stream) {
+    if (stream.fd < 0) {
+        return;
+    }
+    if (::fdatasync(stream.fd) != 0) {
+        std::cerr << "[WAL] Failed to sync " << stream.path << ": " << strerror(errno) << std::endl;
     }
+    ::close(stream.fd);
+    stream.fd = -1;
 }
 
-void WAL::append(const std::string& actor_id, const std::string& key, const std::string& value) {
-    std::lock_guard<std::mutex> lock(mutex_);
+void WAL::fail_stream(Stream& stream, const std::string& what, const std::vector<Entry>& batch) {
+    std::string message = what + " " + stream.path + ": " + strerror(errno);
+    std::cerr << "[WAL] " << message << std::endl;
+    std::vector<uint64_t> abandoned;
+    for (const auto& entry : batch) {
+        abandoned.push_back(entry.seq_no);
+    }
+    {
+        // Nothing is reserved on the stream after this, so these are all it will ever leave behind
+        std::lock_guard<std::mutex> lock(stream.reserve_mutex);
+        stream.failure = message;
+        abandoned.insert(abandoned.end(), stream.reserved.begin(), stream.reserved.end());
+        stream.reserved.clear();
+        stream.ready.clear();
+    }
+    stream.written_cv.notify_all();
+    // Aborted entries will never be written; the watermark must not wait for them
+    std::sort(abandoned.begin(), abandoned.end());
+    for (uint64_t seq_no : abandoned) {
+        mark_committed(seq_no, seq_no);
+    }
+    throw std::runtime_error(message);
+}
+
+size_t WAL::stream_for(const std::string& actor_id) const {
+    return partition_for(actor_id, streams_.size());
+}
+
+uint64_t WAL::append(const std::string& actor_id, const std::string& key, const std::string& value,
+                     Op op, uint64_t version, uint64_t expires_at_ms, uint64_t created_at_ms) {
+    uint64_t seq_no = reserve(actor_id);
+    write_reserved(seq_no, actor_id, key, value, op, version, expires_at_ms, created_at_ms);
+    return seq_no;
+}
+
+uint64_t WAL::reserve(const std::string& actor_id) {
+    auto& stream = *streams_[stream_for(actor_id)];
+    std::lock_guard<std::mutex> lock(stream.reserve_mutex);
+    if (closed_) {
+        throw std::runtime_error("WAL is closed: " + stream.path);
+    }
+    if (!stream.failure.empty()) {
+        throw std::runtime_error(stream.failure);
+    }
+    // Taken under the stream's reservation lock so sequence numbers are monotonic within each file
+    uint64_t seq_no = ++seq_counter_;
+    stream.reserved.push_back(seq_no);
+    return seq_no;
+}
+
+void WAL::write_reserved(uint64_t seq_no, const std::string& actor_id, const std::string& key,
+                         const std::string& value, Op op, uint64_t version, uint64_t expires_at_ms,
+                         uint64_t created_at_ms) {
+    auto& stream = *streams_[stream_for(actor_id)];
     auto now = std::chrono::system_clock::now();
     uint64_t timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count();
+    {
+        std::lock_guard<std::mutex> lock(stream.reserve_mutex);
+        if (stream.failure.empty()) { // otherwise the reservation was already abandoned
+            stream.ready.emplace(seq_no, Entry{seq_no, actor_id, key, value, timestamp, op,
+                                               version, expires_at_ms, created_at_ms});
+        }
+    }
+    flush_ready(stream);
+    wait_written(stream, seq_no);
+}
 
-    Entry entry{++seq_counter_, actor_id, key, value, timestamp};
+void WAL::wait_written(Stream& stream, uint64_t seq_no) {
+    // An earlier reservation not handed over yet holds ours back; its writer flushes both
+    std::unique_lock<std::mutex> lock(stream.reserve_mutex);
+    stream.written_cv.wait(lock, [&stream, seq_no]() {
+        return stream.written_seq >= seq_no || !stream.failure.empty();
+    });
+    if (stream.written_seq < seq_no) {
+        // Whether or not it reached the file, the entry is not known to be durable
+        throw std::runtime_error(stream.failure);
+    }
+}
 
-    if (wal_file_) {
-        wal_file_ << entry.seq_no << "|" << entry.timestamp << "|" 
-                  << actor_id << "|" << key << "|" << value << "\n";
-        wal_file_.flush();
+void WAL::flush_ready(Stream& stream) {
+    std::unique_lock<std::mutex> io(stream.mutex);
+    std::vector<Entry> batch;
+    {
+        std::lock_guard<std::mutex> lock(stream.reserve_mutex);
+        while (!stream.reserved.empty()) {
+            auto it = stream.ready.find(stream.reserved.front());
+            if (it == stream.ready.end()) break;
+            batch.push_back(std::move(it->second));
+            stream.ready.erase(it);
+            stream.reserved.pop_front();
+        }
+    }
+    if (batch.empty()) {
+        return;
     }
 
+    std::string buffer;
+    for (const auto& entry : batch) {
+        encode(EntryView{entry.seq_no, entry.timestamp, entry.actor_id, entry.key, entry.value, entry.op,
+                         entry.version, entry.expires_at_ms, entry.created_at_ms}, buffer);
+    }
+    // One sync for the whole group, before the entries count as committed
+    if (!write_fully(stream.fd, buffer)) {
+        fail_stream(stream, "Failed to write", batch);
+    }
+    if (::fdatasync(stream.fd) != 0) {
+        fail_stream(stream, "Failed to sync", batch);
+    }
+    if (stream.first_seq == 0) stream.first_seq = batch.front().seq_no;
+    stream.last_seq = batch.back().seq_no;
+
+    // A stream's seq_nos interleave with other streams', so commit them run by run
+    size_t run = 0;
+    for (size_t i = 1; i <= batch.size(); ++i) {
+        if (i == batch.size() || batch[i].seq_no != batch[i - 1].seq_no + 1) {
+            mark_committed(batch[run].seq_no, batch[i - 1].seq_no);
+            run = i;
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(stream.reserve_mutex);
+        stream.written_seq = batch.back().seq_no;
+    }
+    stream.written_cv.notify_all();
+
     // Rotate if too large
-    if (std::filesystem::file_size(path_) >= max_size_bytes_) {
-        rotate();
+    bool rotated = std::filesystem::file_size(stream.path) >= max_size_bytes_ && rotate_stream(stream);
+    for (const auto& entry : batch) {
+        notify_handler(entry);
+    }
+    io.unlock();
+    if (rotated) {
+        notify_rotation(stream.index);
+    }
+}
+
+uint64_t WAL::append_batch(const std::vector<EntryView>& entries) {
+    if (entries.empty()) {
+        return 0;
+    }
+    std::vector<size_t> stream_of(entries.size());
+    std::vector<bool> touched(streams_.size(), false);
+    for (size_t i = 0; i < entries.size(); ++i) {
+        stream_of[i] = partition_for(std::string(entries[i].actor_id), streams_.size());
+        touched[stream_of[i]] = true;
+    }
+
+    // Every touched stream's reservations are locked, in index order, while the
+    // range is taken, so sequence numbers stay monotonic within each file
+    uint64_t first_seq;
+    {
+        std::vector<std::unique_lock<std::mutex>> locks;
+        for (size_t s = 0; s < streams_.size(); ++s) {
+            if (touched[s]) locks.emplace_back(streams_[s]->reserve_mutex);
+        }
+        if (closed_) {
+            throw std::runtime_error("WAL is closed");
+        }
+        // As in reserve(): a dead stream would never write its share of the range
+        for (size_t s = 0; s < streams_.size(); ++s) {
+            if (touched[s] && !streams_[s]->failure.empty()) {
+                throw std::runtime_error(streams_[s]->failure);
+            }
+        }
+        first_seq = seq_counter_.fetch_add(entries.size()) + 1;
+        for (size_t i = 0; i < entries.size(); ++i) {
+            streams_[stream_of[i]]->reserved.push_back(first_seq + i);
+        }
     }
-    
-    notify_handler(entry);
-    
+
+    auto now = std::chrono::system_clock::now();
+    uint64_t timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count();
+    for (size_t s = 0; s < streams_.size(); ++s) {
+        if (!touched[s]) continue;
+        auto& stream = *streams_[s];
+        std::lock_guard<std::mutex> lock(stream.reserve_mutex);
+        if (!stream.failure.empty()) continue; // its share was abandoned
+        for (size_t i = 0; i < entries.size(); ++i) {
+            if (stream_of[i] != s) continue;
+            const auto& view = entries[i];
+            stream.ready.emplace(first_seq + i, Entry{first_seq + i, std::string(view.actor_id), std::string(view.key),
+                                                      std::string(view.value), timestamp, view.op,
+                                                      view.version, view.expires_at_ms, view.created_at_ms});
+        }
+    }
+    // Every stream is flushed even if one fails, so no share of the range is left unwritten
+    std::exception_ptr failure;
+    for (size_t s = 0; s < streams_.size(); ++s) {
+        if (!touched[s]) continue;
+        try {
+            flush_ready(*streams_[s]);
+        } catch (const std::exception&) {
+            if (!failure) failure = std::current_exception();
+        }
+    }
+    if (failure) {
+        std::rethrow_exception(failure);
+    }
+    for (size_t i = entries.size(); i-- > 0;) {
+        // The last entry of each stream is enough to wait on
+        if (touched[stream_of[i]]) {
+            wait_written(*streams_[stream_of[i]], first_seq + i);
+            touched[stream_of[i]] = false;
+        }
+    }
+    return first_seq;
 }
 
 void WAL::set_path(const std::string& path) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    path_ = path;
-    open_log();
+    auto paths = stream_paths_for(path, streams_.size());
+    for (size_t i = 0; i < streams_.size(); ++i) {
+        auto& stream = *streams_[i];
+        std::lock_guard<std::mutex> lock(stream.mutex);
+        close_log(stream);
+        stream.path = paths[i];
+        open_log(stream);
+    }
 }
 
 void WAL::register_handler(EntryHandler handler) {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::unique_lock lock(handler_mutex_);
     handler_ = move(handler);
 }
 
 void WAL::rotate() {
-    wal_file_.close();
-    std::string rotated = path_ + ".1";
-    std::filesystem::rename(path_, rotated);
-    open_log();
+    for (auto& stream : streams_) {
+        bool rotated;
+        {
+            std::lock_guard<std::mutex> lock(stream->mutex);
+            rotated = rotate_stream(*stream);
+        }
+        if (rotated) {
+            notify_rotation(stream->index);
+        }
+    }
+}
+
+void WAL::close() {
+    for (auto& stream : streams_) {
+        {
+            // Reservations taken before us are still written out
+            std::unique_lock<std::mutex> lock(stream->reserve_mutex);
+            closed_ = true;
+            stream->written_cv.wait(lock, [&stream]() {
+                return stream->reserved.empty() || !stream->failure.empty();
+            });
+        }
+        // and the last batch finishes before the file goes
+        std::lock_guard<std::mutex> io(stream->mutex);
+        close_log(*stream);
+    }
+}
+
+void WAL::reload() {
+    std::vector<std::string> paths;
+    for (auto& stream : streams_) {
+        close_log(*stream);
+        paths.push_back(stream->path);
+    }
+    seq_counter_ = 0;
+    committed_ahead_.clear();
+    closed_ = false;
+    init_streams(paths);
+}
+
+bool WAL::rotate_stream(Stream& stream) {
+    if (stream.first_seq == 0) {
+        return false; // nothing to seal
+    }
+    close_log(stream);
+    std::string rotated = stream.path + "." + std::to_string(stream.next_segment_no++);
+    std::filesystem::rename(stream.path, rotated);
+    stream.sealed.push_back(Segment{rotated, stream.first_seq, stream.last_seq, true});
+    stream.first_seq = stream.last_seq = 0;
+    write_manifest(stream);
+    open_log(stream);
+    return true;
+}
+
+void WAL::notify_rotation(size_t stream_index) {
+    std::shared_lock lock(handler_mutex_);
+    if (rotation_handler_) {
+        rotation_handler_(stream_index);
+    }
+}
+
+void WAL::set_rotation_handler(RotationHandler handler) {
+    std::unique_lock lock(handler_mutex_);
+    rotation_handler_ = std::move(handler);
+}
+
+std::string WAL::allocate_segment_path(size_t stream_index) {
+    auto& stream = *streams_.at(stream_index);
+    std::lock_guard<std::mutex> lock(stream.mutex);
+    return stream.path + "." + std::to_string(stream.next_segment_no++);
+}
+
+bool WAL::replace_segments(size_t stream_index, const std::vector<std::string>& replaced,
+                           const Segment& replacement) {
+    auto& stream = *streams_.at(stream_index);
+    {
+        std::lock_guard<std::mutex> lock(stream.mutex);
+        if (replaced.empty() || replaced.size() > stream.sealed.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < replaced.size(); ++i) {
+            if (stream.sealed[i].path != replaced[i]) {
+                return false;
+            }
+        }
+        stream.sealed.erase(stream.sealed.begin(), stream.sealed.begin() + replaced.size());
+        stream.sealed.insert(stream.sealed.begin(), replacement);
+        write_manifest(stream);
+    }
+    // Readers holding a mapping keep the old data until they move on
+    for (const auto& path : replaced) {
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+    }
+    return true;
+}
+
+std::vector<WAL::Segment> WAL::segments(size_t stream_index) {
+    auto& stream = *streams_.at(stream_index);
+    std::lock_guard<std::mutex> lock(stream.mutex);
+    auto result = stream.sealed;
+    result.push_back(Segment{stream.path, stream.first_seq, stream.last_seq, false});
+    return result;
+}
+
+void WAL::mark_committed(uint64_t first_seq, uint64_t last_seq) {
+    {
+        std::lock_guard<std::mutex> lock(commit_mutex_);
+        if (last_seq <= committed_seq_) {
+            return;
+        }
+        if (first_seq > committed_seq_ + 1) {
+            for (uint64_t seq_no = first_seq; seq_no <= last_seq; ++seq_no) {
+                committed_ahead_.push_back(seq_no);
+                std::push_heap(committed_ahead_.begin(), committed_ahead_.end(), std::greater<>());
+            }
+            return;
+        }
+        committed_seq_ = last_seq;
+        while (!committed_ahead_.empty() && committed_ahead_.front() == committed_seq_ + 1) {
+            std::pop_heap(committed_ahead_.begin(), committed_ahead_.end(), std::greater<>());
+            committed_ahead_.pop_back();
+            ++committed_seq_;
+        }
+    }
+    commit_cv_.notify_all();
+}
+
+uint64_t WAL::committed_seq() const {
+    std::lock_guard<std::mutex> lock(commit_mutex_);
+    return committed_seq_;
+}
+
+bool WAL::wait_for_commit(uint64_t seq_no, std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(commit_mutex_);
+    return commit_cv_.wait_for(lock, timeout, [this, seq_no]() { return committed_seq_ >= seq_no; });
 }
 
 void WAL::notify_handler(const Entry& entry) {
+    std::shared_lock lock(handler_mutex_);
     if (handler_) {
         handler_(entry);
     }
 }
 
+void WAL::encode(const EntryView& entry, std::string& out) {
+    if (entry.op == Op::Delete) {
+        out += '-'; // tombstone marker
+    }
+    out += std::to_string(entry.seq_no);
+    out += '|';
+    out += std::to_string(entry.timestamp);
+    const bool created = entry.created_at_ms && entry.created_at_ms != entry.timestamp;
+    if (entry.version || entry.expires_at_ms || created) {
+        out += ':';
+        out += std::to_string(entry.version);
+        out += ':';
+        out += std::to_string(entry.expires_at_ms);
+        if (created) {
+            out += ':';
+            out += std::to_string(entry.created_at_ms);
+        }
+    }
+    out += '|';
+    out.append(entry.actor_id.data(), entry.actor_id.size());
+    out += '|';
+    out.append(entry.key.data(), entry.key.size());
+    out += '|';
+    out.append(entry.value.data(), entry.value.size());
+    out += '\n';
+}
+
+bool WAL::decode(std::string_view line, EntryView& entry) {
+    // [-]seq|timestamp[:version:expires_at_ms[:created_at_ms]]|actor_id|key|value, where
+    // the value runs to the end of the line and a leading '-' marks a tombstone
+    entry.op = Op::Put;
+    if (!line.empty() && line.front() == '-') {
+        entry.op = Op::Delete;
+        line.remove_prefix(1);
+    }
+    std::string_view fields[4];
+    size_t start = 0;
+    for (auto& field : fields) {
+        size_t bar = line.find('|', start);
+        if (bar == std::string_view::npos) {
+            return false;
+        }
+        field = line.substr(start, bar - start);
+        start = bar + 1;
+    }
+    auto to_u64 = [](std::string_view text, uint64_t& out) {
+        auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), out);
+        return ec == std::errc() && ptr == text.data() + text.size();
+    };
+    std::string_view stamp = fields[1];
+    entry.version = entry.expires_at_ms = entry.created_at_ms = 0;
+    size_t colon = stamp.find(':');
+    if (colon != std::string_view::npos) {
+        std::string_view meta = stamp.substr(colon + 1);
+        stamp = stamp.substr(0, colon);
+        colon = meta.find(':');
+        if (colon == std::string_view::npos || !to_u64(meta.substr(0, colon), entry.version)) {
+            return false;
+        }
+        meta.remove_prefix(colon + 1);
+        colon = meta.find(':');
+        if (colon != std::string_view::npos) {
+            if (!to_u64(meta.substr(colon + 1), entry.created_at_ms)) {
+                return false;
+            }
+            meta = meta.substr(0, colon);
+        }
+        if (!to_u64(meta, entry.expires_at_ms)) {
+            return false;
+        }
+    }
+    if (!to_u64(fields[0], entry.seq_no) || !to_u64(stamp, entry.timestamp)) {
+        return false;
+    }
+    if (!entry.created_at_ms) {
+        entry.created_at_ms = entry.timestamp;
+    }
+    entry.actor_id = fields[2];
+    entry.key = fields[3];
+    entry.value = line.substr(start);
+    return true;
+}
+
+bool WAL::parse_line(const std::string& line, Entry& entry) {
+    EntryView view;
+    if (!decode(line, view)) {
+        return false;
+    }
+    entry = Entry{view.seq_no, std::string(view.actor_id), std::string(view.key),
+                  std::string(view.value), view.timestamp, view.op, view.version, view.expires_at_ms,
+                  view.created_at_ms};
+    return true;
+}
+
 void WAL::replay() {
-    std::lock_guard<std::mutex> lock(mutex_);
-    std::ifstream infile(path_);
-    std::string line;
-    while (getline(infile, line)) {
-        std::istringstream iss(line);
-        std::string seq_str, ts_str, actor_id, key, value;
-        if (getline(iss, seq_str, '|') &&
-            getline(iss, ts_str, '|') &&
-            getline(iss, actor_id, '|') &&
-            getline(iss, key, '|') &&
-            getline(iss, value)) {
-            Entry e{stoull(seq_str), actor_id, key, value, stoull(ts_str)};
-            notify_handler(e);
-        }
-    }
-}
\ No newline at end of file
+    struct Cursor {
+        std::vector<std::string> files; // sealed segments, then the active file
+        size_t next_file = 0;
+        std::unique_ptr<std::ifstream> in;
+        Entry entry;
+    };
+    auto later = [](const Cursor* a, const Cursor* b) { return a->entry.seq_no > b->entry.seq_no; };
+
+    std::vector<std::unique_lock<std::mutex>> locks;
+    for (auto& stream : streams_) {
+        locks.emplace_back(stream->mutex);
+    }
+
+    // Each stream is ordered on its own; k-way merge them by sequence number
+    std::vector<Cursor> cursors(streams_.size());
+    std::priority_queue<Cursor*, std::vector<Cursor*>, decltype(later)> heap(later);
+    auto advance = [&heap](Cursor& cursor) {
+        std::string line;
+        while (true) {
+            while (cursor.in && getline(*cursor.in, line)) {
+                if (parse_line(line, cursor.entry)) {
+                    heap.push(&cursor);
+                    return;
+                }
+            }
+            if (cursor.next_file == cursor.files.size()) {
+                return;
+            }
+            cursor.in = std::make_unique<std::ifstream>(cursor.files[cursor.next_file++]);
+        }
+    };
+
+    for (size_t i = 0; i < streams_.size(); ++i) {
+        for (const auto& segment : streams_[i]->sealed) {
+            cursors[i].files.push_back(segment.path);
+        }
+        cursors[i].files.push_back(streams_[i]->path);
+        advance(cursors[i]);
+    }
+
+    uint64_t max_seq = seq_counter_.load();
+    while (!heap.empty()) {
+        Cursor* cursor = heap.top();
+        heap.pop();
+        max_seq = std::max(max_seq, cursor->entry.seq_no);
+        notify_handler(cursor->entry);
+        advance(*cursor);
+    }
+    // Resume numbering after the replayed tail
+    seq_counter_.store(max_seq);
+    {
+        std::lock_guard<std::mutex> commit_lock(commit_mutex_);
+        committed_seq_ = std::max(committed_seq_, max_seq);
+    }
+}
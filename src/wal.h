@@ -1,42 +1,188 @@
 #pragma once
 #include <string>
 #include <mutex>
+#include <shared_mutex>
 #include<functional>
 #include <fstream>
 #include <cstdint>
 #include <optional>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <string_view>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <unordered_map>
 
+// Write-ahead log split into N independent streams. Each stream has its own
+// file and mutex, and serves the store shards whose actors hash onto it, so
+// durable writes only contend with writes mapped to the same stream. A global
+// sequence counter orders entries across streams for recovery.
 class WAL
 {
 public:
+    enum class Op : uint8_t { Put, Delete };
+
     struct Entry {
         uint64_t seq_no;
         std::string actor_id;
         std::string key;
         std::string value;
         uint64_t timestamp;
+        Op op = Op::Put;
+        uint64_t version = 0;       // version the write produced; 0 in logs that predate it
+        uint64_t expires_at_ms = 0; // 0: no TTL
+        uint64_t created_at_ms = 0; // 0: same as timestamp
+    };
+
+    // Non-owning view of a record, used by readers that parse a mapped file in place.
+    struct EntryView {
+        uint64_t seq_no;
+        uint64_t timestamp;
+        std::string_view actor_id;
+        std::string_view key;
+        std::string_view value;
+        Op op = Op::Put;
+        uint64_t version = 0;
+        uint64_t expires_at_ms = 0;
+        uint64_t created_at_ms = 0;
+    };
+
+    // A file of one stream: the sealed segments in order, followed by the active file.
+    struct Segment {
+        std::string path;
+        uint64_t first_seq;
+        uint64_t last_seq;
+        bool sealed;
     };
 
     using EntryHandler = std::function<void(const Entry&)>;
+    using RotationHandler = std::function<void(size_t stream)>;
 
-    explicit WAL(const std::string& path = "wal.log", size_t max_size_bytes = 10 * 1024 * 1024);
+    explicit WAL(const std::string& path = "wal.log", size_t max_size_bytes = 10 * 1024 * 1024,
+                 size_t num_streams = 1);
+    // One stream per path, so streams can be spread over directories or disks.
+    explicit WAL(const std::vector<std::string>& stream_paths, size_t max_size_bytes = 10 * 1024 * 1024);
     ~WAL();
-    
-    void append(const std::string& actor_id, const std::string& key, const std::string& value);
+
+    // Returns the seq_no assigned to the entry. version, expires_at_ms and
+    // created_at_ms are logged so replay restores the entry exactly rather
+    // than re-deriving them.
+    uint64_t append(const std::string& actor_id, const std::string& key, const std::string& value,
+                    Op op = Op::Put, uint64_t version = 0, uint64_t expires_at_ms = 0,
+                    uint64_t created_at_ms = 0);
+    // Appends a batch with one write and one flush per stream it touches. The
+    // entries get a contiguous range of seq_nos in batch order (their own
+    // seq_no and timestamp are ignored). Returns the first, or 0 if empty.
+    uint64_t append_batch(const std::vector<EntryView>& entries);
+
+    // Entries are durable when these return: each group of writes to a stream
+    // is synced with one fdatasync before anyone waiting on it is woken.
+    //
+    // Two-phase append for callers that must order entries under their own
+    // lock without doing I/O there. reserve() only assigns the seq_no, in
+    // stream order; write_reserved() hands the entry over after the caller's
+    // lock is released and returns once it is written out. Entries are written
+    // in reservation order, so every reserved seq_no must be written. Whoever
+    // gets to the stream first writes all ready entries in one go.
+    uint64_t reserve(const std::string& actor_id);
+    void write_reserved(uint64_t seq_no, const std::string& actor_id, const std::string& key,
+                        const std::string& value, Op op = Op::Put, uint64_t version = 0,
+                        uint64_t expires_at_ms = 0, uint64_t created_at_ms = 0);
     void set_path(const std::string& path);
     void register_handler(EntryHandler handler);
 
+    // Replays every stream merged in global sequence order.
     void replay();
     void rotate();
 
+    // Flushes and closes every stream; appends after this throw. Used when
+    // another process is about to take the log over.
+    void close();
+    // Closes the files and scans them again from disk, picking up whatever
+    // another process appended since this WAL was opened. Must not run
+    // concurrently with appends or readers.
+    void reload();
+
+    size_t stream_count() const { return streams_.size(); }
+    size_t stream_for(const std::string& actor_id) const;
+    uint64_t last_seq() const { return seq_counter_.load(); }
+    std::vector<Segment> segments(size_t stream);
+
+    // Called whenever a stream seals a segment, after the stream lock is released.
+    void set_rotation_handler(RotationHandler handler);
+    // Reserves a fresh sealed-segment file name for the stream.
+    std::string allocate_segment_path(size_t stream);
+    // Atomically swaps a leading run of sealed segments for one rewritten segment.
+    // Fails if the run is no longer at the head of the stream's manifest.
+    bool replace_segments(size_t stream, const std::vector<std::string>& replaced,
+                          const Segment& replacement);
+
+    // Highest seq_no such that every entry up to it has been written out, in all
+    // streams, or aborted with an error to its writer when its stream failed.
+    uint64_t committed_seq() const;
+    // Blocks until committed_seq() >= seq_no or the timeout expires.
+    bool wait_for_commit(uint64_t seq_no, std::chrono::milliseconds timeout);
+
+    // Appends one log line, including the trailing newline, to out.
+    static void encode(const EntryView& entry, std::string& out);
+    // Parses one log line (without the trailing newline).
+    static bool decode(std::string_view line, EntryView& entry);
+
 private:
+    struct Stream {
+        size_t index = 0;
+        std::string path;
+        int fd = -1;                  // active file, opened for append
+        std::mutex mutex;             // file I/O and the fields below it
+        std::vector<Segment> sealed;  // rotated files, oldest first
+        uint64_t first_seq = 0;       // range held by the active file
+        uint64_t last_seq = 0;
+        uint64_t next_segment_no = 1;
+
+        // Reservations, never held across I/O
+        std::mutex reserve_mutex;
+        std::condition_variable written_cv;
+        std::deque<uint64_t> reserved;              // not yet written, in stream order
+        std::unordered_map<uint64_t, Entry> ready;  // handed over, waiting for earlier ones
+        uint64_t written_seq = 0;                   // every reservation up to here is written and synced
+        std::string failure;                        // set once a write or sync fails; the stream is dead
+    };
+
     EntryHandler handler_;
-    std::string path_;
-    std::ofstream wal_file_;
+    RotationHandler rotation_handler_;
+    std::shared_mutex handler_mutex_;
+    std::vector<std::unique_ptr<Stream>> streams_;
     size_t max_size_bytes_;
-    uint64_t seq_counter_ = 0;
-    std::mutex mutex_;
+    std::atomic<uint64_t> seq_counter_{0};
+    std::atomic<bool> closed_{false};
+
+    // Entries can finish out of order across streams; readers only see the contiguous prefix
+    mutable std::mutex commit_mutex_;
+    std::condition_variable commit_cv_;
+    uint64_t committed_seq_ = 0;
+    std::vector<uint64_t> committed_ahead_; // min-heap of seqs written past a gap
 
     void notify_handler(const Entry& entry);
-    void open_log();
+    // Writes out the ready prefix of the stream's reservations.
+    void flush_ready(Stream& stream);
+    void wait_written(Stream& stream, uint64_t seq_no);
+    void open_log(Stream& stream);
+    // Syncs and closes the active file, if open. Caller holds stream.mutex.
+    void close_log(Stream& stream);
+    // Marks the stream failed and wakes its waiters, then throws. The failed batch
+    // and every reservation still outstanding on the stream count as committed
+    // for the watermark: they are aborted, and their writers get the error.
+    [[noreturn]] void fail_stream(Stream& stream, const std::string& what, const std::vector<Entry>& batch);
+    // Seals the active file; returns false if it was empty. Caller holds stream.mutex.
+    bool rotate_stream(Stream& stream);
+    void notify_rotation(size_t stream_index);
+    void init_streams(const std::vector<std::string>& paths);
+    void load_segments(Stream& stream);
+    void write_manifest(const Stream& stream);
+    void mark_committed(uint64_t first_seq, uint64_t last_seq);
+
+    static std::vector<std::string> stream_paths_for(const std::string& path, size_t num_streams);
+    static bool parse_line(const std::string& line, Entry& entry);
 };
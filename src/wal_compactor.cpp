@@ -0,0 +1,121 @@
+#include "wal_compactor.h"
+#include "utils/durable_file.h"
+#include "utils/mapped_file.h"
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+
+WALCompactor::WALCompactor(std::shared_ptr<WAL> wal, std::shared_ptr<ThreadPool<>> pool,
+                           size_t min_sealed_segments)
+    : wal_(std::move(wal)), pool_(std::move(pool)),
+      min_sealed_segments_(std::max<size_t>(min_sealed_segments, 2)),
+      scheduled_(new std::atomic<bool>[wal_->stream_count()]) {
+    for (size_t i = 0; i < wal_->stream_count(); ++i) {
+        scheduled_[i] = false;
+    }
+}
+
+void WALCompactor::start() {
+    std::weak_ptr<WALCompactor> weak = weak_from_this();
+    wal_->set_rotation_handler([weak](size_t stream) {
+        if (auto self = weak.lock()) {
+            self->schedule(stream);
+        }
+    });
+}
+
+void WALCompactor::stop() {
+    wal_->set_rotation_handler(nullptr);
+}
+
+void WALCompactor::schedule(size_t stream) {
+    if (!pool_ || scheduled_[stream].exchange(true)) {
+        return; // already queued
+    }
+    std::weak_ptr<WALCompactor> weak = weak_from_this();
+    pool_->SubmitBackground([weak, stream]() {
+        if (auto self = weak.lock()) {
+            self->scheduled_[stream] = false;
+            try {
+                self->compact_stream(stream);
+            } catch (const std::exception& ex) {
+                std::cerr << "[WALCompactor] Compaction of stream " << stream
+                          << " failed: " << ex.what() << "\n";
+            }
+        }
+    });
+}
+
+size_t WALCompactor::compact_stream(size_t stream) {
+    std::vector<WAL::Segment> sealed;
+    for (const auto& segment : wal_->segments(stream)) {
+        if (segment.sealed) sealed.push_back(segment);
+    }
+    if (sealed.size() < min_sealed_segments_) {
+        return 0;
+    }
+
+    // Views point into the mappings, so they stay open until the rewrite is done
+    std::vector<MappedFile> files;
+    files.reserve(sealed.size());
+    std::unordered_map<std::string, WAL::EntryView> latest;
+    std::vector<std::string> replaced;
+    size_t records_in = 0;
+    std::string id;
+
+    for (const auto& segment : sealed) {
+        files.emplace_back(segment.path);
+        replaced.push_back(segment.path);
+        std::string_view data = files.back().view();
+        while (!data.empty()) {
+            size_t newline = data.find('\n');
+            if (newline == std::string_view::npos) break;
+            WAL::EntryView entry;
+            if (WAL::decode(data.substr(0, newline), entry)) {
+                ++records_in;
+                id.assign(entry.actor_id.data(), entry.actor_id.size());
+                id += '\0';
+                id.append(entry.key.data(), entry.key.size());
+                latest[id] = entry; // segments are read oldest first, so later records win
+            }
+            data.remove_prefix(newline + 1);
+        }
+    }
+
+    std::vector<WAL::EntryView> survivors;
+    survivors.reserve(latest.size());
+    for (const auto& [_, entry] : latest) {
+        survivors.push_back(entry);
+    }
+    std::sort(survivors.begin(), survivors.end(),
+              [](const WAL::EntryView& a, const WAL::EntryView& b) { return a.seq_no < b.seq_no; });
+
+    std::string buffer;
+    for (const auto& entry : survivors) {
+        WAL::encode(entry, buffer);
+    }
+
+    const std::string out_path = wal_->allocate_segment_path(stream);
+    // The rewrite must be on disk before the manifest stops pointing at the originals
+    durable_file::write_atomically(out_path, buffer);
+
+    WAL::Segment replacement{out_path,
+                             survivors.empty() ? 0 : survivors.front().seq_no,
+                             survivors.empty() ? 0 : survivors.back().seq_no,
+                             true};
+    if (!wal_->replace_segments(stream, replaced, replacement)) {
+        std::filesystem::remove(out_path); // the manifest moved on underneath us
+        return 0;
+    }
+
+    runs_++;
+    records_in_ += records_in;
+    records_out_ += survivors.size();
+    return records_in - survivors.size();
+}
+
+WALCompactor::Stats WALCompactor::stats() const {
+    return Stats{runs_.load(), records_in_.load(), records_out_.load()};
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include <memory>
+#include <vector>
+#include <atomic>
+#include <cstdint>
+#include "wal.h"
+#include "utils/thread_pool.h"
+
+// Online compaction of sealed WAL segments. The sealed prefix of a stream is
+// rewritten so that only the newest record per (actor_id, key) remains,
+// tombstones included, and the rewritten segment replaces the originals in
+// the stream's manifest in a single swap. The active file is never touched.
+//
+// Must be owned by a shared_ptr: scheduled work only holds a weak reference.
+class WALCompactor : public std::enable_shared_from_this<WALCompactor>
+{
+public:
+    struct Stats {
+        uint64_t runs = 0;
+        uint64_t records_in = 0;
+        uint64_t records_out = 0;
+    };
+
+    WALCompactor(std::shared_ptr<WAL> wal, std::shared_ptr<ThreadPool<>> pool,
+                 size_t min_sealed_segments = 4);
+
+    // Compacts a stream whenever a rotation leaves enough sealed segments behind.
+    void start();
+    void stop();
+
+    // Queues compaction of a stream on the pool's background lane.
+    void schedule(size_t stream);
+    // Compacts a stream on the calling thread; returns the number of records dropped.
+    size_t compact_stream(size_t stream);
+
+    Stats stats() const;
+
+private:
+    std::shared_ptr<WAL> wal_;
+    std::shared_ptr<ThreadPool<>> pool_;
+    size_t min_sealed_segments_;
+    std::unique_ptr<std::atomic<bool>[]> scheduled_; // one flag per stream
+    std::atomic<uint64_t> runs_{0};
+    std::atomic<uint64_t> records_in_{0};
+    std::atomic<uint64_t> records_out_{0};
+};
@@ -0,0 +1,137 @@
+#include "wal_cursor.h"
+#include <cstring>
+#include <stdexcept>
+#include <sys/stat.h>
+
+WALCursor::WALCursor(WAL& wal, uint64_t from_seq)
+    : wal_(wal), next_seq_(from_seq == 0 ? 1 : from_seq) {
+    readers_.resize(wal_.stream_count());
+    for (size_t i = 0; i < readers_.size(); ++i) {
+        readers_[i].stream = i;
+        readers_[i].last_seq = next_seq_ - 1;
+    }
+}
+
+size_t WALCursor::next_batch(std::vector<EntryView>& batch, size_t max_entries,
+                             std::chrono::milliseconds timeout) {
+    batch.clear();
+    uint64_t limit = wal_.committed_seq();
+    if (limit < next_seq_) {
+        if (!wal_.wait_for_commit(next_seq_, timeout)) {
+            return 0;
+        }
+        limit = wal_.committed_seq();
+    }
+
+    // The previous batch has been released, so mappings may be refreshed now
+    for (auto& reader : readers_) {
+        reader.stale = false;
+        if (!reader.head) {
+            fill(reader, true);
+        }
+    }
+
+    while (batch.size() < max_entries) {
+        StreamReader* next = nullptr;
+        for (auto& reader : readers_) {
+            if (reader.stale) {
+                // This stream may hold a smaller seq_no behind a remap; finish the batch here
+                return batch.size();
+            }
+            if (reader.head && reader.head->seq_no <= limit &&
+                (!next || reader.head->seq_no < next->head->seq_no)) {
+                next = &reader;
+            }
+        }
+        if (!next) {
+            break;
+        }
+        batch.push_back(*next->head);
+        next_seq_ = next->head->seq_no + 1;
+        next->head.reset();
+        // Remapping now would invalidate views already in the batch
+        next->stale = fill(*next, false) == Fill::Stale;
+    }
+    return batch.size();
+}
+
+WALCursor::Fill WALCursor::fill(StreamReader& reader, bool may_remap) {
+    while (!reader.head) {
+        auto data = reader.file.view();
+        if (reader.offset < data.size()) {
+            const char* start = data.data() + reader.offset;
+            const void* newline = std::memchr(start, '\n', data.size() - reader.offset);
+            if (newline) {
+                std::string_view line(start, static_cast<const char*>(newline) - start);
+                reader.offset += line.size() + 1;
+                EntryView entry;
+                if (WAL::decode(line, entry)) {
+                    reader.last_seq = entry.seq_no;
+                    if (entry.seq_no >= next_seq_) {
+                        reader.head = entry;
+                    }
+                }
+                continue;
+            }
+        }
+
+        // End of the mapping: either this is the tail of the stream or more has been written
+        if (reader.file.is_open() && !reader.sealed) {
+            struct stat file_st, path_st;
+            bool grown = ::fstat(reader.file.fd(), &file_st) == 0 &&
+                         static_cast<size_t>(file_st.st_size) > reader.file.size();
+            bool rotated = ::stat(reader.path.c_str(), &path_st) != 0 ||
+                           path_st.st_ino != file_st.st_ino;
+            if (!grown && !rotated) {
+                return Fill::Exhausted;
+            }
+        }
+        if (!may_remap) {
+            return Fill::Stale;
+        }
+        if (!refresh(reader)) {
+            return Fill::Exhausted;
+        }
+    }
+    return Fill::Ready;
+}
+
+bool WALCursor::refresh(StreamReader& reader) {
+    if (reader.file.remap()) {
+        return true;
+    }
+    if (reader.file.is_open() && !reader.sealed) {
+        struct stat st;
+        if (::stat(reader.path.c_str(), &st) == 0 && st.st_ino == reader.file.inode()) {
+            return false; // still the active file, nothing new
+        }
+        // Rotated away under us: pick up anything written before the rotation
+        if (reader.file.remap()) {
+            return true;
+        }
+    }
+    return open_next(reader);
+}
+
+bool WALCursor::open_next(StreamReader& reader) {
+    for (const auto& segment : wal_.segments(reader.stream)) {
+        if (segment.sealed && (segment.first_seq == 0 || segment.last_seq <= reader.last_seq)) {
+            continue;
+        }
+        try {
+            MappedFile file(segment.path);
+            if (!segment.sealed && reader.file.is_open() && file.inode() == reader.file.inode()) {
+                return false;
+            }
+            file.advise_sequential();
+            reader.file = std::move(file);
+            reader.path = segment.path;
+            reader.sealed = segment.sealed;
+            reader.offset = 0;
+            return true;
+        } catch (const std::exception&) {
+            return false; // removed by rotation or compaction, retry on the next batch
+        }
+    }
+    return false;
+}
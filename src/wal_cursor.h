@@ -0,0 +1,51 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include "wal.h"
+#include "utils/mapped_file.h"
+
+// Tailing reader over a live WAL. The cursor maps each stream's files
+// read-only and merges them in global sequence order, handing out views into
+// the mappings instead of copying records. It follows rotation into new
+// segments and blocks on the WAL's commit watermark when it has caught up.
+class WALCursor
+{
+public:
+    using EntryView = WAL::EntryView;
+
+    WALCursor(WAL& wal, uint64_t from_seq = 1);
+
+    // Fills batch with up to max_entries committed entries starting at position().
+    // Waits up to timeout when there is nothing new. The views stay valid until
+    // the next call on this cursor.
+    size_t next_batch(std::vector<EntryView>& batch, size_t max_entries,
+                      std::chrono::milliseconds timeout);
+
+    // Sequence number of the next entry the cursor will return.
+    uint64_t position() const { return next_seq_; }
+
+private:
+    struct StreamReader {
+        size_t stream = 0;
+        std::string path;
+        bool sealed = false;
+        MappedFile file;
+        size_t offset = 0;
+        uint64_t last_seq = 0;          // last entry consumed from this stream
+        std::optional<EntryView> head;  // next undelivered entry
+        bool stale = false;             // hit the end of its mapping, more may follow
+    };
+
+    enum class Fill { Ready, Exhausted, Stale };
+
+    WAL& wal_;
+    uint64_t next_seq_;
+    std::vector<StreamReader> readers_;
+
+    Fill fill(StreamReader& reader, bool may_remap);
+    bool refresh(StreamReader& reader);
+    bool open_next(StreamReader& reader);
+};
@@ -0,0 +1,196 @@
+#include "warm_restart.h"
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+namespace {
+constexpr char kRequest = 'H';
+constexpr char kState = 'S';
+
+// Sent with the image descriptor
+struct StateMessage {
+    char tag;
+    uint64_t last_seq; // last entry in the predecessor's WAL
+};
+
+sockaddr_un address_of(const std::string& path) {
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(addr.sun_path)) {
+        throw std::runtime_error("Handoff socket path too long: " + path);
+    }
+    std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+    return addr;
+}
+
+std::string shared_memory_dir() {
+    std::error_code ec;
+    return std::filesystem::is_directory("/dev/shm", ec)
+        ? "/dev/shm" : std::filesystem::temp_directory_path().string();
+}
+}
+
+WarmRestart::WarmRestart(std::string socket_path) : socket_path_(std::move(socket_path)) {}
+
+WarmRestart::~WarmRestart() {
+    stop();
+}
+
+bool WarmRestart::adopt(MemStore& store, WAL& wal, const std::string& socket_path,
+                        std::chrono::seconds timeout) {
+    int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        return false;
+    }
+    auto addr = address_of(socket_path);
+    if (::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+        ::close(fd); // nobody to take over from
+        return false;
+    }
+
+    timeval tv{static_cast<time_t>(timeout.count()), 0};
+    ::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    char request = kRequest;
+    if (::send(fd, &request, 1, MSG_NOSIGNAL) != 1) {
+        ::close(fd);
+        return false;
+    }
+
+    StateMessage state{};
+    iovec iov{&state, sizeof(state)};
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))];
+    msghdr msg{};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+    ssize_t n = ::recvmsg(fd, &msg, MSG_CMSG_CLOEXEC | MSG_WAITALL);
+    ::close(fd);
+
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    if (n != static_cast<ssize_t>(sizeof(state)) || state.tag != kState || !cmsg ||
+        cmsg->cmsg_type != SCM_RIGHTS) {
+        throw std::runtime_error("Warm restart handoff failed: predecessor sent no state");
+    }
+    int state_fd;
+    std::memcpy(&state_fd, CMSG_DATA(cmsg), sizeof(int));
+
+    // The image is mapped through its own descriptor, so ours can go right away
+    try {
+        // The predecessor has closed the log: pick up everything it appended
+        // since we opened it, before the image's tail is replayed from it
+        wal.reload();
+        if (wal.last_seq() < state.last_seq) {
+            throw std::runtime_error("WAL ends at " + std::to_string(wal.last_seq()) +
+                                     ", predecessor logged up to " + std::to_string(state.last_seq));
+        }
+        store.recover_from_image("/proc/self/fd/" + std::to_string(state_fd));
+    } catch (...) {
+        ::close(state_fd);
+        throw;
+    }
+    ::close(state_fd);
+    return true;
+}
+
+void WarmRestart::listen(std::function<void()> on_request) {
+    listen_fd_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (listen_fd_ < 0) {
+        throw std::runtime_error("Failed to create handoff socket: " + std::string(strerror(errno)));
+    }
+    // A successor that adopted our state took over the path; so do we
+    ::unlink(socket_path_.c_str());
+    auto addr = address_of(socket_path_);
+    if (::bind(listen_fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+        ::listen(listen_fd_, 1) != 0) {
+        ::close(listen_fd_);
+        listen_fd_ = -1;
+        throw std::runtime_error("Failed to listen on " + socket_path_ + ": " + strerror(errno));
+    }
+
+    listener_ = std::thread([this, on_request = std::move(on_request)]() {
+        while (!stopping_) {
+            pollfd pfd{listen_fd_, POLLIN, 0};
+            if (::poll(&pfd, 1, 200) <= 0) continue;
+
+            int client = ::accept4(listen_fd_, nullptr, nullptr, SOCK_CLOEXEC);
+            if (client < 0) continue;
+            char request = 0;
+            if (::recv(client, &request, 1, 0) != 1 || request != kRequest) {
+                ::close(client);
+                continue;
+            }
+            client_fd_ = client;
+            std::cout << "[WarmRestart] Successor connected, handing over" << std::endl;
+            on_request();
+            return;
+        }
+    });
+}
+
+bool WarmRestart::hand_over(MemStore& store, WAL& wal) {
+    int client = client_fd_.exchange(-1);
+    if (client < 0) {
+        return false;
+    }
+    const std::string path = shared_memory_dir() + "/iquora-" + std::to_string(::getpid()) + ".img";
+    int state_fd = -1;
+    StateMessage state{kState, 0};
+    try {
+        // Nothing is appended from here on, so the image and the log end at the same entry
+        wal.close();
+        state.last_seq = wal.last_seq();
+        store.write_image(path);
+        state_fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    } catch (const std::exception& ex) {
+        std::cerr << "[WarmRestart] Export failed: " << ex.what() << std::endl;
+    }
+    // Unlinked now, the region lives exactly as long as someone holds it open
+    ::unlink(path.c_str());
+    if (state_fd < 0) {
+        ::close(client); // the successor sees the failure and recovers cold
+        return false;
+    }
+
+    iovec iov{&state, sizeof(state)};
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+    msghdr msg{};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+    std::memcpy(CMSG_DATA(cmsg), &state_fd, sizeof(int));
+    bool sent = ::sendmsg(client, &msg, MSG_NOSIGNAL) == static_cast<ssize_t>(sizeof(state));
+    if (!sent) {
+        std::cerr << "[WarmRestart] Failed to pass state: " << strerror(errno) << std::endl;
+    }
+    ::close(state_fd);
+    ::close(client);
+    return sent;
+}
+
+void WarmRestart::stop() {
+    stopping_ = true;
+    if (listener_.joinable()) {
+        listener_.join();
+    }
+    if (listen_fd_ >= 0) {
+        ::close(listen_fd_);
+        listen_fd_ = -1;
+    }
+    int client = client_fd_.exchange(-1);
+    if (client >= 0) {
+        ::close(client);
+    }
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include <string>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include "mem_store.h"
+#include "wal.h"
+
+// Warm restart: a new process takes over the in-memory state of the one it
+// replaces without reading checkpoints or replaying the WAL.
+//
+// The running process listens on a Unix socket. The successor binds the
+// service port first (SO_REUSEPORT) with its requests held, then connects.
+// From then on new connections can land on either process and none are
+// refused. The predecessor stops serving, drains and closes its WAL, exports
+// its shards as a snapshot image in shared memory (/dev/shm) and passes the
+// open descriptor back over the socket with SCM_RIGHTS, together with the
+// last sequence number it logged. Only then does the successor rescan the WAL,
+// map the image as its base layer and release its requests. The region is
+// freed once both sides have closed it.
+class WarmRestart
+{
+public:
+    explicit WarmRestart(std::string socket_path = "iquora.handoff");
+    ~WarmRestart();
+
+    WarmRestart(const WarmRestart&) = delete;
+    WarmRestart& operator=(const WarmRestart&) = delete;
+
+    // Successor side. Returns false straight away when no predecessor is
+    // listening; otherwise waits for its state, reloads wal once the
+    // predecessor has closed it and installs the state in store.
+    static bool adopt(MemStore& store, WAL& wal, const std::string& socket_path,
+                      std::chrono::seconds timeout = std::chrono::seconds(60));
+
+    // Predecessor side. Accepts a successor on a background thread and calls
+    // on_request there, which should stop the server so hand_over() can run.
+    void listen(std::function<void()> on_request);
+    bool requested() const { return client_fd_.load() >= 0; }
+    // Closes the WAL, exports the store and passes it to the waiting
+    // successor. Returns false if the successor did not get it.
+    bool hand_over(MemStore& store, WAL& wal);
+    void stop();
+
+private:
+    std::string socket_path_;
+    int listen_fd_ = -1;
+    std::atomic<int> client_fd_{-1};
+    std::atomic<bool> stopping_{false};
+    std::thread listener_;
+};
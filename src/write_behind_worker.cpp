@@ -1,12 +1,27 @@
 #include "write_behind_worker.h"
 #include "wal.h"
+#include "utils/common_utility.h"
+#include <algorithm>
 #include <chrono>
 #include <iostream>
-#include "utils/threadsafe_queue.h"
 using namespace std;
 
-WriteBehindWorker::WriteBehindWorker(MemStore &store, WAL &wal, size_t batch_size)
-    : store_(store), wal_(wal), batch_size_(batch_size), dirty_queue_(1000, BoundedThreadsafeQueue<DirtyRecord>::OverflowPolicy::Block) {}
+WriteBehindWorker::WriteBehindWorker(IStore &store, WAL &wal, size_t batch_size, size_t num_partitions,
+                                     WriteBehindTuning tuning)
+    : store_(store), wal_(wal), tuning_(tuning)
+{
+    tuning_.min_batch = std::max<size_t>(tuning_.min_batch, 1);
+    tuning_.max_batch = std::max(tuning_.max_batch, tuning_.min_batch);
+    tuning_.min_interval = std::max(tuning_.min_interval, std::chrono::milliseconds(1));
+    tuning_.max_interval = std::max(tuning_.max_interval, tuning_.min_interval);
+
+    const size_t count = num_partitions ? num_partitions : wal.stream_count();
+    for (size_t i = 0; i < count; ++i)
+    {
+        partitions_.push_back(std::make_unique<Partition>());
+    }
+    set_batch_size(batch_size);
+}
 
 WriteBehindWorker::~WriteBehindWorker()
 {
@@ -18,7 +33,10 @@ void WriteBehindWorker::start()
     if (!running_)
     {
         running_ = true;
-        worker_ = thread(&WriteBehindWorker::run, this);
+        for (auto &partition : partitions_)
+        {
+            partition->worker = thread(&WriteBehindWorker::run, this, std::ref(*partition));
+        }
     }
 }
 
@@ -26,75 +44,217 @@ void WriteBehindWorker::stop()
 {
     running_ = false;
 
-    if (worker_.joinable())
+    for (auto &partition : partitions_)
     {
-        worker_.join();
+        {
+            lock_guard<mutex> lock(partition->mutex);
+        }
+        partition->cv.notify_all();
+        if (partition->worker.joinable())
+        {
+            partition->worker.join();
+        }
+        // Flush the remaining records if any
+        if (!process_batch(*partition))
+        {
+            lock_guard<mutex> lock(partition->mutex);
+            std::cerr << "[WriteBehind] Dropping " << partition->window.size()
+                      << " unwritten records on stop\n";
+            records_dropped_ += partition->window.size();
+            partition->window.clear();
+            partition->index.clear();
+            partition->window_records = 0;
+        }
     }
-    // Flush the remaining records if any
-    process_batch();
 }
 
-void WriteBehindWorker::run()
+void WriteBehindWorker::run(Partition &partition)
 {
-    auto last_flush = std::chrono::steady_clock::now();
-    auto flush_interval = std::chrono::milliseconds(500); // configurable
+    unique_lock<mutex> lock(partition.mutex);
 
     while (running_)
     {
-        DirtyRecord record;
+        // Sleep until a window opens, then give it the flush interval from its first record
+        partition.cv.wait(lock, [&]() { return !running_ || !partition.window.empty(); });
+        auto interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double, std::milli>(partition.flush_interval_ms.load()));
+        partition.cv.wait_until(lock, partition.window_started + interval, [&]() {
+            return !running_ || partition.window.size() >= partition.batch_size;
+        });
+        lock.unlock();
+        process_batch(partition);
+        lock.lock();
+    }
+}
 
-        if (dirty_queue_.WaitAndPop(record, std::chrono::milliseconds(100)))
+void WriteBehindWorker::enqueue(const DirtyRecord &record)
+{
+    records_enqueued_++;
+    auto &partition = *partitions_[partition_for(record.actor_id, partitions_.size())];
+    bool wake;
+    {
+        lock_guard<mutex> lock(partition.mutex);
+        partition.window_records++;
+        auto [it, inserted] = partition.index.try_emplace(DirtyKey{record.actor_id, record.key},
+                                                          partition.window.size());
+        const bool opened = partition.window.empty();
+        if (inserted)
         {
-            lock_guard<mutex> lock(batch_mutex_);
-            current_batch_.push_back(record);
-
-            if (current_batch_.size() >= batch_size_)
+            if (opened)
             {
-                process_batch();
-                last_flush = std::chrono::steady_clock::now();
+                partition.window_started = std::chrono::steady_clock::now();
             }
+            partition.window.push_back(record);
         }
-        auto now = std::chrono::steady_clock::now();
-
-        if (now - last_flush >= flush_interval && !current_batch_.empty()) {
-            process_batch();
-            last_flush = now;
+        else
+        {
+            partition.window[it->second] = record; // supersedes the pending write
         }
+        wake = opened || partition.window.size() >= partition.batch_size;
+    }
+    if (wake)
+    {
+        partition.cv.notify_one();
     }
 }
 
-void WriteBehindWorker::enqueue(const DirtyRecord &record)
+void WriteBehindWorker::set_batch_size(size_t size)
+{
+    // With the controller on this only resets its starting point; it starts
+    // from the shortest interval, so lag is low until load proves otherwise
+    size = std::clamp(size, tuning_.min_batch, tuning_.max_batch);
+    for (auto &partition : partitions_)
+    {
+        partition->batch_size = size;
+        partition->flush_interval_ms = static_cast<double>(
+            (tuning_.adaptive ? tuning_.min_interval : tuning_.max_interval).count());
+    }
+}
+
+void WriteBehindWorker::adapt(Partition &partition, uint64_t window_records,
+                              std::chrono::steady_clock::duration lag)
 {
-    dirty_queue_.Push(record);
+    const auto lag_ms = std::chrono::duration_cast<std::chrono::milliseconds>(lag);
+    partition.last_lag_ms = lag_ms.count();
+    if (!tuning_.adaptive)
+    {
+        return;
+    }
+    const double min_interval = static_cast<double>(tuning_.min_interval.count());
+    const double max_interval = static_cast<double>(tuning_.max_interval.count());
+    double interval = partition.flush_interval_ms;
+    size_t batch = partition.batch_size;
+
+    if (lag_ms > tuning_.target_lag || window_records < tuning_.min_batch)
+    {
+        // Multiplicative decrease: over the lag budget, or waiting bought no coalescing
+        interval = std::max(min_interval, interval / 2);
+        batch = std::max(tuning_.min_batch, batch / 2);
+    }
+    else
+    {
+        // Additive increase while the windows are busy and within budget
+        interval = std::min(max_interval, interval + std::max(1.0, tuning_.target_lag.count() / 16.0));
+        batch = std::min(tuning_.max_batch, batch + tuning_.min_batch);
+    }
+    partition.flush_interval_ms = interval;
+    partition.batch_size = batch;
 }
 
-void WriteBehindWorker::set_batch_size(size_t size)
+WriteBehindWorker::Stats WriteBehindWorker::stats() const
 {
-    lock_guard<mutex> lock(batch_mutex_);
-    batch_size_ = size;
+    Stats stats;
+    stats.records_enqueued = records_enqueued_.load();
+    stats.records_written = records_written_.load();
+    stats.batches = batches_.load();
+    stats.failed_flushes = failed_flushes_.load();
+    stats.records_dropped = records_dropped_.load();
+    for (const auto &partition : partitions_)
+    {
+        {
+            lock_guard<mutex> lock(partition->mutex);
+            stats.pending += partition->window.size();
+        }
+        stats.batch_size += partition->batch_size;
+        stats.flush_interval_ms += partition->flush_interval_ms;
+        stats.max_lag_ms = std::max<uint64_t>(stats.max_lag_ms, partition->last_lag_ms);
+    }
+    stats.batch_size /= partitions_.size();
+    stats.flush_interval_ms /= partitions_.size();
+    return stats;
 }
 
-void WriteBehindWorker::process_batch()
+void WriteBehindWorker::requeue(Partition &partition, std::vector<DirtyRecord> &batch, uint64_t window_records)
+{
+    lock_guard<mutex> lock(partition.mutex);
+    std::vector<DirtyRecord> window;
+    window.reserve(batch.size() + partition.window.size());
+    for (auto &record : batch)
+    {
+        if (!partition.index.count(DirtyKey{record.actor_id, record.key}))
+        {
+            window.push_back(std::move(record));
+        }
+    }
+    for (auto &record : partition.window)
+    {
+        window.push_back(std::move(record));
+    }
+    partition.window.swap(window);
+    partition.index.clear();
+    for (size_t i = 0; i < partition.window.size(); ++i)
+    {
+        partition.index.emplace(DirtyKey{partition.window[i].actor_id, partition.window[i].key}, i);
+    }
+    partition.window_records += window_records;
+    // Retry after a full interval rather than spinning on a failing WAL
+    partition.window_started = std::chrono::steady_clock::now();
+    partition.flush_interval_ms = static_cast<double>(tuning_.max_interval.count());
+}
+
+bool WriteBehindWorker::process_batch(Partition &partition)
 {
     std::vector<DirtyRecord> batch;
+    uint64_t window_records;
+    std::chrono::steady_clock::time_point window_started;
     {
-        std::lock_guard<std::mutex> lock(batch_mutex_);
-        batch.swap(current_batch_);
+        std::lock_guard<std::mutex> lock(partition.mutex);
+        window_started = partition.window_started;
+        batch.swap(partition.window);
+        partition.index.clear();
+        window_records = partition.window_records;
+        partition.window_records = 0;
     }
 
     if (!batch.empty())
     {
-        try { // Batch write to WAL
+        try { // Batch write to WAL: one write per stream for the whole window
+            std::vector<WAL::EntryView> entries;
+            entries.reserve(batch.size());
             for (const auto &record : batch)
             {
-                wal_.append(record.actor_id, record.key, record.value);
+                WAL::EntryView entry{};
+                entry.actor_id = record.actor_id;
+                entry.key = record.key;
+                entry.value = record.value;
+                entry.op = record.deleted ? WAL::Op::Delete : WAL::Op::Put;
+                entry.version = record.version;
+                entry.expires_at_ms = record.expires_at_ms;
+                entry.created_at_ms = record.created_at_ms;
+                entries.push_back(entry);
             }
+            wal_.append_batch(entries);
 
-            // Optional: Batch persist to disk/database
-            std::cout << "[WriteBehind] Processed batch of " << batch.size() << " records\n";
+            records_written_ += batch.size();
+            batches_++;
+            adapt(partition, window_records, std::chrono::steady_clock::now() - window_started);
         } catch (const std::exception& ex){
-            std::cerr << "[WriteBehind] Error while flushing batch: " << ex.what() << "\n";
-            // TODO: retry logic or dead-letter queue
+            std::cerr << "[WriteBehind] Error while flushing batch of " << batch.size()
+                      << " records, re-queued: " << ex.what() << "\n";
+            requeue(partition, batch, window_records);
+            failed_flushes_++;
+            return false;
         }
     }
-}
\ No newline at end of file
+    return true;
+}
@@ -4,11 +4,37 @@
 #include <vector>
 #include <mutex>
 #include <atomic>
-#include "utils/threadsafe_queue.h"
+#include <memory>
+#include <chrono>
+#include <condition_variable>
+#include <unordered_map>
+#include <utility>
 
-class MemStore;   // forward declare
+class IStore;     // forward declare
 class WAL;        // forward declare
 
+// Bounds for the adaptive flush controller. After every flush each partition
+// compares the lag of the window it wrote (age of its first record plus the
+// flush time) with target_lag. Over budget, or a window too light to be
+// worth the wait, halves both the flush interval and the batch size; a busy
+// window within budget grows both by one step. Light load thus converges on
+// quick small flushes and bursts on large batches just inside the target.
+struct WriteBehindTuning {
+    bool adaptive = true;               // false: flush every max_interval or batch_size keys
+    size_t min_batch = 16;
+    size_t max_batch = 4096;
+    std::chrono::milliseconds min_interval{5};
+    std::chrono::milliseconds max_interval{500};
+    std::chrono::milliseconds target_lag{200};
+};
+
+// Write-behind pipeline split into partitions by actor hash, each with its own
+// flush window and worker thread. By default there is one partition per WAL
+// stream and both use the same hash, so each worker appends to a single stream.
+//
+// enqueue() never waits on I/O: it adds the record to its partition's window
+// under a short mutex, and the worker swaps the window out before writing it.
+// It is safe to call with store locks held.
 class WriteBehindWorker
 {
 public:
@@ -17,25 +43,85 @@ public:
         std::string actor_id;
         std::string key;
         std::string value;
+        bool deleted = false;
+        uint64_t version = 0;       // logged with the entry, see WAL::append
+        uint64_t expires_at_ms = 0;
+        uint64_t created_at_ms = 0;
     };
 
-    WriteBehindWorker(MemStore &store, WAL &wal, size_t batch_size = 100);
+    struct Stats
+    {
+        uint64_t records_enqueued = 0; // records handed to enqueue()
+        uint64_t records_written = 0;  // WAL appends left after coalescing
+        uint64_t batches = 0;
+        uint64_t failed_flushes = 0;   // WAL appends that threw; their windows were re-queued
+        uint64_t records_dropped = 0;  // still unwritten when stop() gave up on them
+        uint64_t pending = 0;          // keys waiting in the flush windows
+        double batch_size = 0;         // current controller settings, averaged over partitions
+        double flush_interval_ms = 0;
+        uint64_t max_lag_ms = 0;       // worst window lag seen by the last flushes
+        // Records absorbed per WAL append; 1.0 means nothing was coalesced
+        double coalescing_ratio() const {
+            return records_written ? static_cast<double>(records_enqueued) / records_written : 1.0;
+        }
+    };
+
+    // num_partitions = 0 gives one partition per WAL stream. batch_size is the
+    // starting point for the controller.
+    WriteBehindWorker(IStore &store, WAL &wal, size_t batch_size = 100, size_t num_partitions = 0,
+                      WriteBehindTuning tuning = WriteBehindTuning());
     ~WriteBehindWorker();
     void start();
     void stop();
     void enqueue(const DirtyRecord& record);
     void set_batch_size(size_t size);
+    size_t partition_count() const { return partitions_.size(); }
+    Stats stats() const;
 
 private:
-    void run();
-    void process_batch();
+    using DirtyKey = std::pair<std::string, std::string>; // (actor_id, key)
+    struct DirtyKeyHash
+    {
+        size_t operator()(const DirtyKey& key) const {
+            return std::hash<std::string>{}(key.first) * 31 ^ std::hash<std::string>{}(key.second);
+        }
+    };
+
+    struct Partition
+    {
+        mutable std::mutex mutex;
+        std::condition_variable cv;
+        // The flush window holds only the latest record per key, in first-write
+        // order, so a hot key costs one WAL append per window however often it changes
+        std::vector<DirtyRecord> window;
+        std::unordered_map<DirtyKey, size_t, DirtyKeyHash> index; // key -> slot in window
+        uint64_t window_records = 0;
+        std::chrono::steady_clock::time_point window_started;
+        std::thread worker;
+
+        // Controller state, only touched by the worker (and read by stats())
+        std::atomic<size_t> batch_size{0};
+        std::atomic<double> flush_interval_ms{0};
+        std::atomic<uint64_t> last_lag_ms{0};
+    };
+
+    void run(Partition& partition);
+    // Returns false if the WAL append failed; the window is then back in the partition.
+    bool process_batch(Partition& partition);
+    // Puts a window that failed to flush back ahead of the records enqueued since,
+    // skipping keys that were written again in the meantime.
+    void requeue(Partition& partition, std::vector<DirtyRecord>& batch, uint64_t window_records);
+    void adapt(Partition& partition, uint64_t window_records, std::chrono::steady_clock::duration lag);
 
-    std::thread worker_;
     std::atomic<bool> running_{false};
-    MemStore &store_;
+    IStore &store_;
     WAL &wal_;
-    BoundedThreadsafeQueue<DirtyRecord> dirty_queue_;
-    size_t batch_size_;
-    std::mutex batch_mutex_;
-    std::vector<DirtyRecord> current_batch_;
+    WriteBehindTuning tuning_;
+    std::vector<std::unique_ptr<Partition>> partitions_;
+
+    std::atomic<uint64_t> records_enqueued_{0};
+    std::atomic<uint64_t> records_written_{0};
+    std::atomic<uint64_t> batches_{0};
+    std::atomic<uint64_t> failed_flushes_{0};
+    std::atomic<uint64_t> records_dropped_{0};
 };
@@ -0,0 +1,72 @@
+#pragma once
+#include <functional>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Minimal test harness: TEST_CASE registers a function, CHECK records a
+// failure and carries on, REQUIRE stops the current case.
+namespace check {
+
+struct Case {
+    const char* name;
+    std::function<void()> body;
+};
+
+inline std::vector<Case>& cases() {
+    static std::vector<Case> all;
+    return all;
+}
+
+inline int& failures() {
+    static int count = 0;
+    return count;
+}
+
+struct Register {
+    Register(const char* name, std::function<void()> body) {
+        cases().push_back({name, std::move(body)});
+    }
+};
+
+struct Abort {};
+
+inline bool report(bool ok, const char* expr, const char* file, int line) {
+    if (!ok) {
+        ++failures();
+        std::cerr << file << ":" << line << ": check failed: " << expr << std::endl;
+    }
+    return ok;
+}
+
+inline int run_all() {
+    for (auto& test : cases()) {
+        int before = failures();
+        try {
+            test.body();
+        } catch (const Abort&) {
+        } catch (const std::exception& e) {
+            ++failures();
+            std::cerr << test.name << ": exception: " << e.what() << std::endl;
+        }
+        std::cout << (failures() == before ? "[ OK ] " : "[FAIL] ") << test.name << std::endl;
+    }
+    return failures() == 0 ? 0 : 1;
+}
+
+} // namespace check
+
+#define CHECK_CONCAT_(a, b) a##b
+#define CHECK_CONCAT(a, b) CHECK_CONCAT_(a, b)
+#define TEST_CASE(name)                                                          \
+    static void name();                                                          \
+    static ::check::Register CHECK_CONCAT(register_, name)(#name, name);         \
+    static void name()
+#define CHECK(expr) ::check::report(static_cast<bool>(expr), #expr, __FILE__, __LINE__)
+#define REQUIRE(expr)                                                            \
+    do {                                                                         \
+        if (!CHECK(expr)) throw ::check::Abort{};                                \
+    } while (0)
+#define TEST_MAIN()                                                              \
+    int main() { return ::check::run_all(); }
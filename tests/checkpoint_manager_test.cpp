@@ -0,0 +1,103 @@
+#include <algorithm>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include "checkpoint_manager.h"
+#include "mem_store.h"
+#include "check.h"
+#include "test_dir.h"
+
+TEST_CASE(cold_start_without_checkpoint_replays_the_wal) {
+    TestDir dir("ckpt-cold");
+    const std::string wal_path = dir.file("wal.log");
+    {
+        MemStore store(std::make_shared<WAL>(wal_path));
+        store.set("actor", "k", "a");
+        store.set("actor", "gone", "x");
+        store.del("actor", "gone");
+    }
+
+    auto store = std::make_shared<MemStore>(std::make_shared<WAL>(wal_path));
+    auto checkpoints = std::make_shared<CheckpointManager>(store, nullptr, dir.file("checkpoints"));
+    REQUIRE(!checkpoints->recover());
+    store->recover_from_wal();
+    CHECK(store->get("actor", "k") == std::optional<std::string>("a"));
+    CHECK(!store->get("actor", "gone").has_value());
+
+    // The first checkpoint now covers what was replayed, so later restarts keep it
+    checkpoints->checkpoint();
+    auto restarted = std::make_shared<MemStore>(std::make_shared<WAL>(wal_path));
+    REQUIRE(std::make_shared<CheckpointManager>(restarted, nullptr, dir.file("checkpoints"))->recover());
+    CHECK(restarted->get("actor", "k") == std::optional<std::string>("a"));
+}
+
+TEST_CASE(recover_applies_the_delta_chain_and_wal_tail) {
+    TestDir dir("ckpt-chain");
+    const std::string wal_path = dir.file("wal.log");
+    {
+        auto store = std::make_shared<MemStore>(std::make_shared<WAL>(wal_path));
+        auto checkpoints = std::make_shared<CheckpointManager>(store, nullptr, dir.file("checkpoints"));
+        store->set("a", "k", "1");
+        store->set("b", "k", "1");
+        checkpoints->checkpoint(); // base
+        store->set("a", "k", "2");
+        checkpoints->checkpoint(); // delta: a
+        store->del("b", "k");
+        store->set("c", "k", "1");
+        checkpoints->checkpoint(); // delta: b removed, c added
+        store->set("a", "k", "3"); // only in the WAL
+        CHECK(checkpoints->delta_count() == 2);
+        CHECK(checkpoints->stats().full_checkpoints == 1);
+        CHECK(checkpoints->stats().delta_checkpoints == 2);
+    }
+
+    auto store = std::make_shared<MemStore>(std::make_shared<WAL>(wal_path));
+    auto checkpoints = std::make_shared<CheckpointManager>(store, nullptr, dir.file("checkpoints"));
+    CHECK(checkpoints->delta_count() == 2);
+    REQUIRE(checkpoints->recover());
+    CHECK(store->get("a", "k") == std::optional<std::string>("3"));
+    CHECK(!store->get("b", "k").has_value());
+    CHECK(store->get("c", "k") == std::optional<std::string>("1"));
+}
+
+TEST_CASE(merge_folds_deltas_into_a_new_base) {
+    TestDir dir("ckpt-merge");
+    const std::string wal_path = dir.file("wal.log");
+    const std::string ckpt_dir = dir.file("checkpoints");
+    {
+        auto store = std::make_shared<MemStore>(std::make_shared<WAL>(wal_path));
+        // No pool: the merge runs inline once the third delta is written
+        auto checkpoints = std::make_shared<CheckpointManager>(store, nullptr, ckpt_dir, 3);
+        store->set("a", "k", "1");
+        store->set("b", "k", "1");
+        checkpoints->checkpoint();
+        store->set("a", "k", "2");
+        checkpoints->checkpoint();
+        store->del("b", "k");
+        checkpoints->checkpoint();
+        CHECK(checkpoints->delta_count() == 2);
+        store->set("c", "k", "1");
+        checkpoints->checkpoint();
+        CHECK(checkpoints->stats().merges == 1);
+        CHECK(checkpoints->delta_count() == 0);
+        CHECK(!checkpoints->merge()); // nothing left to fold
+    }
+
+    // Only the merged base and the manifest are left
+    std::vector<std::string> files;
+    for (const auto& entry : std::filesystem::directory_iterator(ckpt_dir)) {
+        files.push_back(entry.path().filename().string());
+    }
+    std::sort(files.begin(), files.end());
+    REQUIRE(files.size() == 2);
+    CHECK(files[0] == "CHECKPOINT");
+    CHECK(files[1].rfind("base-", 0) == 0);
+
+    auto store = std::make_shared<MemStore>(std::make_shared<WAL>(wal_path));
+    REQUIRE(std::make_shared<CheckpointManager>(store, nullptr, ckpt_dir)->recover());
+    CHECK(store->get("a", "k") == std::optional<std::string>("2"));
+    CHECK(!store->get("b", "k").has_value());
+    CHECK(store->get("c", "k") == std::optional<std::string>("1"));
+}
+
+TEST_MAIN()
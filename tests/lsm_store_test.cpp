@@ -0,0 +1,31 @@
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include "lsm_store.h"
+#include "check.h"
+#include "test_dir.h"
+
+TEST_CASE(replay_restores_versions_and_expiry) {
+    TestDir dir("lsm-replay");
+    const std::string wal_path = dir.file("wal.log");
+    {
+        auto store = LSMStore::Open(dir.file("lsm"), std::make_shared<WAL>(wal_path));
+        store->set("actor", "k", "a");
+        store->set("actor", "k", "b");
+        REQUIRE(store->set_if_version("actor", "k", "c", 2));
+        store->set("actor", "short", "v", 1);
+    }
+
+    // Nothing was flushed, so everything comes back from the WAL
+    auto store = LSMStore::Open(dir.file("lsm"), std::make_shared<WAL>(wal_path));
+    CHECK(store->get("actor", "k") == std::optional<std::string>("c"));
+    CHECK(!store->set_if_version("actor", "k", "d", 4));
+    CHECK(store->set_if_version("actor", "k", "d", 3));
+
+    CHECK(store->get("actor", "short").has_value());
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+    CHECK(!store->get("actor", "short").has_value());
+}
+
+TEST_MAIN()
@@ -0,0 +1,205 @@
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "actor_lifecycle.h"
+#include "mem_store.h"
+#include "snapshot.h"
+#include "utils/thread_pool.h"
+#include "check.h"
+#include "test_dir.h"
+
+namespace {
+uint64_t now_ms() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+}
+
+TEST_CASE(replay_restores_logged_versions) {
+    TestDir dir("store-versions");
+    auto wal = std::make_shared<WAL>(dir.file("wal.log"));
+    {
+        MemStore store(wal);
+        store.set("actor", "k", "a");
+        store.set("actor", "k", "b");
+        REQUIRE(store.set_if_version("actor", "k", "c", 2));
+    }
+
+    // A snapshot that already holds the writes but records an older WAL
+    // position, as when it is pinned while they are being logged
+    const std::string snapshot = dir.file("snapshot");
+    {
+        SnapshotWriter writer(snapshot, 0);
+        writer.add(SnapshotRecord{"actor", "k", "c", 3, now_ms(), 0, false});
+        writer.finish();
+    }
+
+    MemStore recovered(wal);
+    recovered.recover_from_snapshot(snapshot);
+    CHECK(recovered.get("actor", "k") == std::optional<std::string>("c"));
+    // Replaying the overlap must not bump the version past the one the writer saw
+    CHECK(!recovered.set_if_version("actor", "k", "d", 5));
+    CHECK(recovered.set_if_version("actor", "k", "d", 3));
+}
+
+TEST_CASE(stale_set_if_version_leaves_nothing_behind) {
+    TestDir dir("store-stale-version");
+    MemStore store(std::make_shared<WAL>(dir.file("wal.log")));
+    CHECK(!store.set_if_version("ghost", "k", "v", 3));
+    CHECK(!store.get("ghost", "k"));
+    CHECK(store.dirty_actor_count() == 0);
+
+    store.set("actor", "k", "a");
+    store.write_checkpoint(dir.file("checkpoint"), false);
+    CHECK(!store.set_if_version("actor", "k", "b", 2));
+    CHECK(!store.set_if_version("actor", "other", "b", 1));
+    CHECK(!store.get("actor", "other"));
+    CHECK(store.dirty_actor_count() == 0);
+    CHECK(store.set_if_version("actor", "k", "b", 1));
+    CHECK(store.set_if_version("actor", "other", "b", 0)); // version 0: the key is new
+    CHECK(store.get("actor", "k") == std::optional<std::string>("b"));
+}
+
+TEST_CASE(replay_restores_expiry) {
+    TestDir dir("store-ttl");
+    auto wal = std::make_shared<WAL>(dir.file("wal.log"));
+    {
+        MemStore store(wal);
+        store.set("actor", "short", "v", 1);
+        store.set("actor", "kept", "v");
+    }
+
+    const std::string snapshot = dir.file("snapshot");
+    {
+        SnapshotWriter writer(snapshot, 0);
+        writer.finish();
+    }
+    MemStore recovered(wal);
+    recovered.recover_from_snapshot(snapshot);
+    CHECK(recovered.get("actor", "short").has_value());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+    CHECK(!recovered.get("actor", "short").has_value());
+    CHECK(recovered.get("actor", "kept").has_value());
+}
+
+TEST_CASE(reads_keep_an_actor_resident) {
+    TestDir dir("store-access");
+    auto wal = std::make_shared<WAL>(dir.file("wal.log"));
+    MemStore store(wal);
+    store.enable_passivation(dir.file("passivated"));
+    store.set("busy", "k", "v");
+    store.set("idle", "k", "v");
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    // A read alone counts as access, even though it takes only the shared lock
+    CHECK(store.get("busy", "k") == std::optional<std::string>("v"));
+    auto passivated = store.passivate_idle(std::chrono::milliseconds(40));
+    REQUIRE(passivated.size() == 1u);
+    CHECK(passivated[0] == "idle");
+    CHECK(!store.is_passivated("busy"));
+    CHECK(store.is_passivated("idle"));
+}
+
+TEST_CASE(passivated_actors_stay_active) {
+    TestDir dir("store-lifecycle");
+    auto wal = std::make_shared<WAL>(dir.file("wal.log"));
+    auto store = std::make_shared<MemStore>(wal);
+    store->enable_passivation(dir.file("passivated"));
+    ActorLifecycle lifecycle(store);
+    REQUIRE(lifecycle.SpawnActor("actor", {{"k", "v"}}));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    REQUIRE(lifecycle.PassivateIdleActors(std::chrono::milliseconds(10)).size() == 1u);
+    // Subscribers check IsActorActive: passivation must not turn them away
+    CHECK(lifecycle.IsActorActive("actor"));
+    CHECK(!lifecycle.IsActorResident("actor"));
+
+    CHECK(store->get("actor", "k") == std::optional<std::string>("v"));
+    CHECK(lifecycle.IsActorResident("actor"));
+    REQUIRE(lifecycle.TerminateActor("actor"));
+    CHECK(!lifecycle.IsActorActive("actor"));
+}
+
+TEST_CASE(parallel_snapshot_round_trips_with_wal_tail) {
+    TestDir dir("store-parallel");
+    const std::string wal_path = dir.file("wal.log");
+    const std::string snapshot_dir = dir.file("snapshot");
+    auto pool = std::make_shared<ThreadPool<>>(4);
+    {
+        MemStore store(std::make_shared<WAL>(wal_path), pool);
+        for (int i = 0; i < 64; ++i) {
+            store.set("actor" + std::to_string(i), "k", "v" + std::to_string(i));
+        }
+        store.snapshot_parallel(snapshot_dir);
+        store.set("actor0", "k", "after-first");
+        store.del("actor1", "k");
+        // The second set replaces the first, whose files are removed
+        store.snapshot_parallel(snapshot_dir);
+        store.set("actor2", "k", "wal-tail");
+    }
+
+    const auto manifest = SnapshotManifest::read(snapshot_dir + "/MANIFEST");
+    size_t snap_files = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(snapshot_dir)) {
+        snap_files += entry.path().extension() == ".snap";
+    }
+    CHECK(snap_files == manifest.files.size());
+
+    MemStore recovered(std::make_shared<WAL>(wal_path), pool);
+    recovered.recover_parallel(snapshot_dir);
+    CHECK(recovered.get("actor0", "k") == std::optional<std::string>("after-first"));
+    CHECK(!recovered.get("actor1", "k").has_value());
+    CHECK(recovered.get("actor2", "k") == std::optional<std::string>("wal-tail"));
+    for (int i = 3; i < 64; ++i) {
+        CHECK(recovered.get("actor" + std::to_string(i), "k") == std::optional<std::string>("v" + std::to_string(i)));
+    }
+}
+
+TEST_CASE(image_overlay_round_trips) {
+    TestDir dir("store-image");
+    const std::string wal_path = dir.file("wal.log");
+    const std::string first = dir.file("first.img");
+    const std::string second = dir.file("second.img");
+    {
+        MemStore store(std::make_shared<WAL>(wal_path));
+        store.set("a", "k1", "a1");
+        store.set("a", "k2", "a2");
+        store.set("b", "k", "b1");
+        store.set("c", "k", "c1");
+        store.set("d", "k", "d1");
+        store.write_image(first);
+    }
+
+    {
+        MemStore store(std::make_shared<WAL>(wal_path));
+        store.recover_from_image(first);
+        CHECK(store.get("a", "k2") == std::optional<std::string>("a2"));
+        // Writes copy the actor up into the overlay, keeping its other keys
+        store.set("a", "k1", "a1-new");
+        CHECK(store.get("a", "k2") == std::optional<std::string>("a2"));
+        CHECK(store.del("b", "k"));
+        CHECK(!store.get("b", "k").has_value());
+        CHECK(store.set_if_version("c", "k", "c2", 1));
+        store.set("e", "k", "e1");
+        // Both layers go into the next image: overlay actors shadow base ones
+        store.write_image(second);
+        store.set("d", "k", "d2"); // after the image, only in the WAL
+    }
+
+    MemStore store(std::make_shared<WAL>(wal_path));
+    store.recover_from_image(second);
+    CHECK(store.get("a", "k1") == std::optional<std::string>("a1-new"));
+    CHECK(store.get("a", "k2") == std::optional<std::string>("a2"));
+    CHECK(!store.get("b", "k").has_value());
+    CHECK(store.get("c", "k") == std::optional<std::string>("c2"));
+    CHECK(store.get("d", "k") == std::optional<std::string>("d2"));
+    CHECK(store.get("e", "k") == std::optional<std::string>("e1"));
+    CHECK(!store.set_if_version("c", "k", "c3", 1)); // the version survived the image
+    CHECK(store.set_if_version("c", "k", "c3", 2));
+}
+
+TEST_MAIN()
@@ -0,0 +1,218 @@
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "mem_store.h"
+#include "pubsub.h"
+#include "check.h"
+#include "test_dir.h"
+
+namespace {
+SubscriptionSystem::EventPtr event(uint64_t seq) {
+    return std::make_shared<const ChangeEvent>("actor", "k", "v", seq);
+}
+}
+
+TEST_CASE(sequencer_releases_in_ticket_order) {
+    std::vector<uint64_t> seen;
+    EventSequencer sequencer([&](const SubscriptionSystem::EventPtr& e) { seen.push_back(e->seq_no); });
+    uint64_t t1 = sequencer.ticket();
+    uint64_t t2 = sequencer.ticket();
+    uint64_t t3 = sequencer.ticket();
+    uint64_t t4 = sequencer.ticket();
+
+    sequencer.post(t3, event(3));
+    sequencer.post(t2, event(2));
+    CHECK(seen.empty()); // both wait for the first ticket
+    sequencer.post(t1, event(1));
+    CHECK(seen == std::vector<uint64_t>({1, 2, 3}));
+    // An abandoned write releases its turn without an event
+    uint64_t t5 = sequencer.ticket();
+    sequencer.post(t5, event(5));
+    sequencer.post(t4, nullptr);
+    CHECK(seen == std::vector<uint64_t>({1, 2, 3, 5}));
+}
+
+TEST_CASE(sequencer_tracks_the_oldest_unpublished_seq) {
+    std::vector<uint64_t> seen;
+    EventSequencer sequencer([&](const SubscriptionSystem::EventPtr& e) { seen.push_back(e->seq_no); });
+    CHECK(sequencer.oldest_unpublished() == 0u);
+    uint64_t t1 = sequencer.ticket(10);
+    uint64_t t2 = sequencer.ticket(); // not logged yet: never holds the watermark back
+    uint64_t t3 = sequencer.ticket(12);
+    CHECK(sequencer.oldest_unpublished() == 10u);
+
+    sequencer.post(t3, event(12));
+    CHECK(sequencer.oldest_unpublished() == 10u); // posted, but waiting for t1
+    sequencer.post(t1, event(10));
+    CHECK(sequencer.oldest_unpublished() == 12u);
+    sequencer.post(t2, event(0));
+    CHECK(sequencer.oldest_unpublished() == 0u);
+    CHECK(seen == std::vector<uint64_t>({10, 0, 12}));
+}
+
+TEST_CASE(published_seq_covers_delivered_events) {
+    TestDir dir("pubsub-published");
+    MemStore store(std::make_shared<WAL>(dir.file("wal.log")), std::make_shared<ThreadPool<>>(2));
+    std::mutex mutex;
+    std::vector<uint64_t> seen;
+    std::map<std::string, uint64_t> last_per_actor;
+    bool in_order = true;
+    store.change_feed().subscribe([&](const SubscriptionSystem::EventPtr& e) {
+        std::lock_guard<std::mutex> lock(mutex);
+        seen.push_back(e->seq_no);
+        uint64_t& last = last_per_actor[e->actor_id];
+        in_order = in_order && e->seq_no > last;
+        last = e->seq_no;
+    });
+    for (int i = 0; i < 50; ++i) {
+        store.set("actor" + std::to_string(i % 7), "k", std::to_string(i));
+        // Whatever the store reports as published has reached the subscriber
+        const uint64_t published = store.published_seq();
+        std::lock_guard<std::mutex> lock(mutex);
+        for (uint64_t seq = 1; seq <= published; ++seq) {
+            CHECK(std::find(seen.begin(), seen.end(), seq) != seen.end());
+        }
+    }
+    for (int i = 0; i < 400 && store.published_seq() < 50; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    CHECK(store.published_seq() == 50u);
+}
+
+TEST_CASE(store_events_arrive_in_wal_order) {
+    TestDir dir("pubsub-order");
+    auto wal = std::make_shared<WAL>(dir.file("wal.log"), 10 * 1024 * 1024, 4);
+    MemStore store(wal, std::make_shared<ThreadPool<>>(4));
+
+    std::mutex mutex;
+    std::vector<uint64_t> seen;
+    std::map<std::string, uint64_t> last_per_actor;
+    bool in_order = true;
+    store.change_feed().subscribe([&](const SubscriptionSystem::EventPtr& e) {
+        std::lock_guard<std::mutex> lock(mutex);
+        seen.push_back(e->seq_no);
+        uint64_t& last = last_per_actor[e->actor_id];
+        in_order = in_order && e->seq_no > last;
+        last = e->seq_no;
+    });
+
+    constexpr int kThreads = 8, kWrites = 200;
+    std::vector<std::thread> writers;
+    for (int t = 0; t < kThreads; ++t) {
+        writers.emplace_back([&store, t]() {
+            for (int i = 0; i < kWrites; ++i) {
+                store.set("actor" + std::to_string(t), "k" + std::to_string(i % 5), std::to_string(i));
+            }
+        });
+    }
+    for (auto& writer : writers) writer.join();
+
+    for (int i = 0; i < 400; ++i) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (seen.size() == kThreads * kWrites) break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    REQUIRE(seen.size() == static_cast<size_t>(kThreads * kWrites));
+    // Each actor's writes in WAL order; shards interleave, but none is lost
+    CHECK(in_order);
+    std::sort(seen.begin(), seen.end());
+    for (size_t i = 0; i < seen.size(); ++i) {
+        CHECK(seen[i] == i + 1);
+    }
+}
+
+TEST_CASE(filter_trie_routes_each_key_to_matching_subscribers_once) {
+    SubscriptionSystem subs;
+    std::vector<std::string> got;
+    auto record = [&got](const std::string& name) {
+        return [&got, name](const SubscriptionSystem::EventPtr& e) { got.push_back(name + ":" + e->key); };
+    };
+    subs.subscribe("actor", record("all"));
+    subs.subscribe("actor", record("exact"), {KeyFilter::key("user.name")});
+    subs.subscribe("actor", record("prefix"), {KeyFilter::prefix("user.")});
+    subs.subscribe("actor", record("glob"), {KeyFilter::glob("user.*.id")});
+    // Overlapping filters must still deliver once
+    auto both = subs.subscribe("actor", record("both"), {KeyFilter::prefix("user"), KeyFilter::key("user.name")});
+    subs.subscribe("other", record("elsewhere"));
+
+    auto deliver = [&](const std::string& key) {
+        got.clear();
+        subs.notify(std::make_shared<const ChangeEvent>("actor", key, "v"));
+        std::sort(got.begin(), got.end());
+        return got;
+    };
+    CHECK(deliver("user.name") ==
+          std::vector<std::string>({"all:user.name", "both:user.name", "exact:user.name", "prefix:user.name"}));
+    CHECK(deliver("user.42.id") ==
+          std::vector<std::string>({"all:user.42.id", "both:user.42.id", "glob:user.42.id", "prefix:user.42.id"}));
+    CHECK(deliver("user") == std::vector<std::string>({"all:user", "both:user"}));
+    CHECK(deliver("session") == std::vector<std::string>({"all:session"}));
+
+    REQUIRE(subs.unsubscribe("actor", both));
+    CHECK(deliver("user.name") ==
+          std::vector<std::string>({"all:user.name", "exact:user.name", "prefix:user.name"}));
+    CHECK(subs.subscriber_count("actor") == 4u);
+}
+
+TEST_CASE(group_rebalance_is_sticky) {
+    ChangeFeed feed(12);
+    auto noop = [](const SubscriptionSystem::EventPtr&) {};
+    auto a = feed.subscribe(noop, "", "g", {}, 100);
+    CHECK(feed.assignment(a).size() == 12u);
+    CHECK(feed.take_moves(a).empty()); // started with them, nothing to replay
+
+    auto b = feed.subscribe(noop, "", "g", {}, 100);
+    feed.take_moves(b); // as the server does on attach
+    auto a_before = feed.assignment(a);
+    auto b_before = feed.assignment(b);
+    CHECK(a_before.size() == 6u);
+    CHECK(b_before.size() == 6u);
+
+    auto c = feed.subscribe(noop, "", "g", {}, 100);
+    // Only c's share moved; a and b kept everything else they had
+    auto a_after = feed.assignment(a), b_after = feed.assignment(b), c_after = feed.assignment(c);
+    CHECK(a_after.size() == 4u);
+    CHECK(b_after.size() == 4u);
+    CHECK(c_after.size() == 4u);
+    for (size_t p : a_after) CHECK(std::count(a_before.begin(), a_before.end(), p) == 1);
+    for (size_t p : b_after) CHECK(std::count(b_before.begin(), b_before.end(), p) == 1);
+
+    // Leaving hands b's partitions to the others, with how far b had got
+    feed.take_moves(a);
+    feed.take_moves(c);
+    feed.acknowledge(b, 250);
+    REQUIRE(feed.unsubscribe(b));
+    auto moved = feed.take_moves(a);
+    auto moved_c = feed.take_moves(c);
+    moved.insert(moved.end(), moved_c.begin(), moved_c.end());
+    REQUIRE(moved.size() == 4u);
+    for (const auto& move : moved) {
+        CHECK(std::count(b_after.begin(), b_after.end(), move.partition) == 1);
+        CHECK(move.from_seq == 250u);
+    }
+    CHECK(feed.assignment(a).size() + feed.assignment(c).size() == 12u);
+    CHECK(feed.assignment(a).size() == 6u);
+}
+
+TEST_CASE(acknowledge_skips_partitions_not_yet_replayed) {
+    ChangeFeed feed(4);
+    auto noop = [](const SubscriptionSystem::EventPtr&) {};
+    auto a = feed.subscribe(noop, "", "g", {}, 10);
+    auto b = feed.subscribe(noop, "", "g", {}, 10);
+    // b has not taken its moves yet, so its acknowledgement must not cover them
+    feed.acknowledge(b, 50);
+    REQUIRE(feed.unsubscribe(b));
+    auto moves = feed.take_moves(a);
+    REQUIRE(moves.size() == 2u);
+    for (const auto& move : moves) CHECK(move.from_seq == 10u);
+}
+
+TEST_MAIN()
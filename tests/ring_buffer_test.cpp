@@ -0,0 +1,104 @@
+#include <chrono>
+#include <string>
+#include <vector>
+#include "utils/ring_buffer.h"
+#include "check.h"
+
+using namespace std::chrono_literals;
+using Ring = RingBuffer<std::string>;
+
+namespace {
+// "key=value"; conflation keys on the part before '='
+std::string key_of(const std::string& item) {
+    return item.substr(0, item.find('='));
+}
+
+std::vector<std::string> drain(Ring& ring) {
+    std::vector<std::string> out;
+    ring.WaitAndPopBatch(out, 100, 0ms);
+    return out;
+}
+}
+
+TEST_CASE(drop_oldest_makes_room) {
+    Ring ring(3, Ring::OverflowPolicy::DropOldest);
+    for (const char* item : {"a", "b", "c", "d"}) {
+        CHECK(ring.Push(item));
+    }
+    CHECK(ring.GetDroppedCount() == 1u);
+    CHECK(drain(ring) == std::vector<std::string>({"b", "c", "d"}));
+    CHECK(ring.Size() == 0u);
+}
+
+TEST_CASE(conflate_keeps_every_event_while_there_is_room) {
+    Ring ring(4, Ring::OverflowPolicy::Conflate, key_of);
+    for (const char* item : {"a=1", "a=2", "b=1", "a=3"}) {
+        CHECK(ring.Push(item));
+    }
+    CHECK(ring.GetConflatedCount() == 0u);
+    CHECK(drain(ring) == std::vector<std::string>({"a=1", "a=2", "b=1", "a=3"}));
+}
+
+TEST_CASE(conflate_replaces_the_latest_copy_on_overflow) {
+    Ring ring(3, Ring::OverflowPolicy::Conflate, key_of);
+    for (const char* item : {"a=1", "b=1", "a=2"}) {
+        CHECK(ring.Push(item));
+    }
+    // Full: a newer a replaces the latest a, not the first
+    CHECK(ring.Push("a=3"));
+    CHECK(ring.GetConflatedCount() == 1u);
+    CHECK(ring.GetDroppedCount() == 0u);
+    // Full with a new key: the oldest event goes
+    CHECK(ring.Push("c=1"));
+    CHECK(ring.GetDroppedCount() == 1u);
+    CHECK(drain(ring) == std::vector<std::string>({"b=1", "a=3", "c=1"}));
+
+    // Positions that were popped no longer conflate
+    CHECK(ring.Push("a=4"));
+    CHECK(drain(ring) == std::vector<std::string>({"a=4"}));
+}
+
+TEST_CASE(positions_track_what_has_left_the_ring) {
+    Ring ring(2, Ring::OverflowPolicy::Conflate, key_of);
+    CHECK(ring.Push("a=1"));
+    CHECK(ring.Push("b=1"));
+    const uint64_t mark = ring.TailPosition();
+    CHECK(mark == 2u);
+    // Replaced in place: a later event now sits before the mark
+    CHECK(ring.Push("a=2"));
+    CHECK(ring.TailPosition() == mark);
+
+    std::vector<std::string> out;
+    ring.WaitAndPopBatch(out, 1, 0ms);
+    CHECK(out == std::vector<std::string>({"a=2"}));
+    CHECK(ring.HeadPosition() < mark); // b=1 is still buffered
+    ring.WaitAndPopBatch(out, 1, 0ms);
+    CHECK(ring.HeadPosition() == mark);
+
+    // Drops move the head too
+    for (const char* item : {"c=1", "d=1", "e=1"}) {
+        CHECK(ring.Push(item));
+    }
+    CHECK(ring.HeadPosition() == mark + 1);
+    CHECK(ring.TailPosition() == mark + 3);
+}
+
+TEST_CASE(disconnect_refuses_once_full) {
+    Ring ring(2, Ring::OverflowPolicy::Disconnect);
+    CHECK(ring.Push("a"));
+    CHECK(ring.Push("b"));
+    CHECK(!ring.Push("c"));
+    CHECK(ring.Overflowed());
+    CHECK(drain(ring).empty());
+    CHECK(!ring.Push("d"));
+}
+
+TEST_CASE(close_wakes_the_consumer) {
+    Ring ring(2, Ring::OverflowPolicy::DropOldest);
+    ring.Close();
+    std::vector<std::string> out;
+    CHECK(ring.WaitAndPopBatch(out, 10, 1s) == 0u);
+    CHECK(!ring.Push("a"));
+}
+
+TEST_MAIN()
@@ -0,0 +1,25 @@
+#pragma once
+#include <filesystem>
+#include <string>
+#include <unistd.h>
+
+// Scratch directory for a test, removed again when it goes out of scope.
+class TestDir
+{
+public:
+    explicit TestDir(const std::string& name)
+        : path_(std::filesystem::temp_directory_path() /
+                ("iquora-" + name + "-" + std::to_string(::getpid()))) {
+        std::filesystem::remove_all(path_);
+        std::filesystem::create_directories(path_);
+    }
+    ~TestDir() {
+        std::error_code ec;
+        std::filesystem::remove_all(path_, ec);
+    }
+
+    std::string file(const std::string& name) const { return (path_ / name).string(); }
+
+private:
+    std::filesystem::path path_;
+};
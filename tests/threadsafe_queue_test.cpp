@@ -0,0 +1,98 @@
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include "utils/threadsafe_queue.h"
+#include "check.h"
+
+using namespace std::chrono_literals;
+using Queue = BoundedThreadsafeQueue<std::string>;
+
+namespace {
+// "key=value"; compaction keys on the part before '='
+std::string key_of(const std::string& item) {
+    return item.substr(0, item.find('='));
+}
+
+std::vector<std::string> drain(Queue& queue) {
+    std::vector<std::string> out;
+    std::string item;
+    while (queue.TryPop(item)) out.push_back(item);
+    return out;
+}
+}
+
+TEST_CASE(compact_replaces_in_place) {
+    Queue queue(3, key_of);
+    for (const char* item : {"a=1", "b=1", "c=1", "b=2"}) {
+        queue.Push(item);
+    }
+    CHECK(queue.GetCompactedCount() == 1u);
+    CHECK(queue.GetSize() == 3u);
+    // b=2 took b=1's place in line rather than going to the back
+    CHECK(drain(queue) == std::vector<std::string>({"a=1", "b=2", "c=1"}));
+}
+
+TEST_CASE(compact_blocks_for_a_new_key) {
+    Queue queue(2, key_of);
+    queue.Push("a=1");
+    queue.Push("b=1");
+
+    std::atomic<bool> pushed{false};
+    std::thread pusher([&]() {
+        queue.Push("c=1");
+        pushed = true;
+    });
+    std::this_thread::sleep_for(50ms);
+    CHECK(!pushed); // nothing to fold c into, so it waits instead of dropping
+    CHECK(queue.GetSize() == 2u);
+
+    std::string item;
+    REQUIRE(queue.TryPop(item));
+    CHECK(item == "a=1");
+    pusher.join();
+    CHECK(pushed);
+    CHECK(queue.GetCompactedCount() == 0u);
+    CHECK(drain(queue) == std::vector<std::string>({"b=1", "c=1"}));
+}
+
+TEST_CASE(compact_index_follows_pops) {
+    Queue queue(3, key_of);
+    // Below capacity a repeated key just queues again; the index moves to the newest
+    queue.Push("a=1");
+    queue.Push("a=2");
+    queue.Push("b=1");
+
+    std::string item;
+    REQUIRE(queue.TryPop(item));
+    CHECK(item == "a=1"); // popping the older a must keep a=2 indexed
+    queue.Push("c=1");
+    queue.Push("a=3");
+    queue.Push("c=2");
+    CHECK(queue.GetCompactedCount() == 2u);
+    CHECK(drain(queue) == std::vector<std::string>({"a=3", "b=1", "c=2"}));
+
+    // Once popped, a key leaves the index: a full queue waits rather than compacts
+    queue.Push("x=1");
+    queue.Push("y=1");
+    queue.Push("z=1");
+    REQUIRE(queue.TryPop(item));
+    CHECK(item == "x=1");
+    queue.Push("w=1");
+    std::atomic<bool> pushed{false};
+    std::thread pusher([&]() {
+        queue.Push("x=2");
+        pushed = true;
+    });
+    std::this_thread::sleep_for(50ms);
+    CHECK(!pushed);
+    queue.Push("y=2");
+    CHECK(queue.GetCompactedCount() == 3u);
+    REQUIRE(queue.TryPop(item));
+    CHECK(item == "y=2");
+    pusher.join();
+    CHECK(drain(queue) == std::vector<std::string>({"z=1", "w=1", "x=2"}));
+}
+
+TEST_MAIN()
@@ -0,0 +1,95 @@
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "mem_store.h"
+#include "wal.h"
+#include "wal_compactor.h"
+#include "check.h"
+#include "test_dir.h"
+
+namespace {
+std::vector<std::string> read_lines(const std::string& path) {
+    std::vector<std::string> lines;
+    std::ifstream in(path);
+    std::string line;
+    while (getline(in, line)) {
+        lines.push_back(line);
+    }
+    return lines;
+}
+}
+
+TEST_CASE(compaction_keeps_the_latest_record_per_key) {
+    TestDir dir("compact");
+    const std::string wal_path = dir.file("wal.log");
+    std::vector<std::string> originals;
+    {
+        auto wal = std::make_shared<WAL>(wal_path);
+        {
+            MemStore store(wal);
+            store.set("a", "k", "1");
+            store.set("b", "k", "1");
+            wal->rotate();
+            store.set("a", "k", "2");
+            store.del("b", "k");
+            wal->rotate();
+            store.set("a", "k", "3"); // stays in the active file
+        }
+        for (const auto& segment : wal->segments(0)) {
+            if (segment.sealed) originals.push_back(segment.path);
+        }
+        REQUIRE(originals.size() == 2);
+
+        auto compactor = std::make_shared<WALCompactor>(wal, nullptr, 2);
+        CHECK(compactor->compact_stream(0) == 2);
+        CHECK(compactor->stats().records_in == 4);
+        CHECK(compactor->stats().records_out == 2);
+
+        auto segments = wal->segments(0);
+        REQUIRE(segments.size() == 2);
+        REQUIRE(segments[0].sealed);
+        CHECK(!segments[1].sealed);
+
+        // The manifest names only the rewrite, and the originals are gone
+        auto manifest = read_lines(wal_path + ".manifest");
+        REQUIRE(manifest.size() == 1);
+        CHECK(manifest[0] == std::filesystem::path(segments[0].path).filename().string());
+        for (const auto& path : originals) {
+            CHECK(!std::filesystem::exists(path));
+        }
+
+        // a's newest sealed put, then b's tombstone, in seq order
+        auto lines = read_lines(segments[0].path);
+        REQUIRE(lines.size() == 2);
+        WAL::EntryView put, tombstone;
+        REQUIRE(WAL::decode(lines[0], put));
+        REQUIRE(WAL::decode(lines[1], tombstone));
+        CHECK(put.actor_id == "a");
+        CHECK(put.value == "2");
+        CHECK(put.op == WAL::Op::Put);
+        CHECK(tombstone.actor_id == "b");
+        CHECK(tombstone.op == WAL::Op::Delete);
+        CHECK(put.seq_no < tombstone.seq_no);
+    }
+
+    // A restart follows the manifest, so replay sees the compacted history
+    MemStore store(std::make_shared<WAL>(wal_path));
+    store.recover_from_wal();
+    CHECK(store.get("a", "k") == std::optional<std::string>("3"));
+    CHECK(!store.get("b", "k").has_value());
+}
+
+TEST_CASE(too_few_sealed_segments_are_left_alone) {
+    TestDir dir("compact-few");
+    auto wal = std::make_shared<WAL>(dir.file("wal.log"));
+    wal->append("a", "k", "1");
+    wal->rotate();
+    auto compactor = std::make_shared<WALCompactor>(wal, nullptr, 2);
+    CHECK(compactor->compact_stream(0) == 0);
+    CHECK(compactor->stats().runs == 0);
+    CHECK(read_lines(dir.file("wal.log.manifest")).size() == 1);
+}
+
+TEST_MAIN()
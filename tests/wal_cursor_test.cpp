@@ -0,0 +1,67 @@
+#include <string>
+#include <vector>
+#include "wal.h"
+#include "wal_cursor.h"
+#include "check.h"
+#include "test_dir.h"
+
+using namespace std::chrono_literals;
+
+TEST_CASE(merges_streams_in_sequence_order) {
+    TestDir dir("cursor-merge");
+    WAL wal(dir.file("wal.log"), 10 * 1024 * 1024, 3);
+    for (int i = 0; i < 30; ++i) {
+        wal.append("actor" + std::to_string(i % 7), "k" + std::to_string(i), "v" + std::to_string(i));
+    }
+
+    WALCursor cursor(wal);
+    std::vector<WAL::EntryView> batch;
+    uint64_t expected = 1;
+    while (cursor.next_batch(batch, 8, 0ms) > 0) {
+        for (const auto& entry : batch) {
+            CHECK(entry.seq_no == expected);
+            CHECK(entry.key == "k" + std::to_string(expected - 1));
+            ++expected;
+        }
+    }
+    CHECK(expected == 31u);
+    CHECK(cursor.position() == 31u);
+}
+
+TEST_CASE(starts_from_requested_sequence) {
+    TestDir dir("cursor-from");
+    WAL wal(dir.file("wal.log"));
+    for (int i = 0; i < 10; ++i) {
+        wal.append("actor", "k" + std::to_string(i), "v");
+    }
+
+    WALCursor cursor(wal, 6);
+    std::vector<WAL::EntryView> batch;
+    REQUIRE(cursor.next_batch(batch, 100, 0ms) == 5u);
+    CHECK(batch.front().seq_no == 6u);
+    CHECK(batch.back().seq_no == 10u);
+}
+
+TEST_CASE(follows_rotation_and_new_writes) {
+    TestDir dir("cursor-rotate");
+    WAL wal(dir.file("wal.log"));
+    wal.append("actor", "a", "1");
+    wal.append("actor", "b", "2", WAL::Op::Delete);
+
+    WALCursor cursor(wal);
+    std::vector<WAL::EntryView> batch;
+    REQUIRE(cursor.next_batch(batch, 100, 0ms) == 2u);
+    CHECK(batch[1].op == WAL::Op::Delete);
+
+    // Nothing new yet
+    CHECK(cursor.next_batch(batch, 100, 10ms) == 0u);
+
+    wal.rotate();
+    wal.append("actor", "c", "3");
+    REQUIRE(cursor.next_batch(batch, 100, 100ms) == 1u);
+    CHECK(batch[0].seq_no == 3u);
+    CHECK(batch[0].key == "c");
+    CHECK(batch[0].value == "3");
+}
+
+TEST_MAIN()
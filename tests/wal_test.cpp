@@ -0,0 +1,218 @@
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "wal.h"
+#include "check.h"
+#include "test_dir.h"
+#include <csignal>
+#include <sys/resource.h>
+
+namespace {
+// Writes that would grow a file past limit bytes fail with EFBIG while in scope
+class FileSizeLimit
+{
+public:
+    explicit FileSizeLimit(rlim_t limit) {
+        ::getrlimit(RLIMIT_FSIZE, &saved_);
+        std::signal(SIGXFSZ, SIG_IGN);
+        rlimit lowered{limit, saved_.rlim_max};
+        ::setrlimit(RLIMIT_FSIZE, &lowered);
+    }
+    ~FileSizeLimit() { ::setrlimit(RLIMIT_FSIZE, &saved_); }
+
+private:
+    rlimit saved_{};
+};
+
+// Two actors that land in different streams
+std::pair<std::string, std::string> actors_on_two_streams(const WAL& wal) {
+    std::string first = "a0";
+    std::string second = "a1";
+    for (int i = 2; wal.stream_for(second) == wal.stream_for(first); ++i) {
+        second = "a" + std::to_string(i);
+    }
+    return {first, second};
+}
+
+bool throws(const std::function<void()>& f) {
+    try {
+        f();
+    } catch (const std::runtime_error&) {
+        return true;
+    }
+    return false;
+}
+}
+
+TEST_CASE(rotation_handler_runs_outside_stream_lock) {
+    TestDir dir("wal-rotation");
+    WAL wal(dir.file("wal.log"), 64);
+    std::vector<size_t> sealed_counts;
+    // Inspecting the stream from the handler would deadlock if it ran under the stream lock
+    wal.set_rotation_handler([&](size_t stream) {
+        size_t sealed = 0;
+        for (const auto& segment : wal.segments(stream)) {
+            sealed += segment.sealed;
+        }
+        sealed_counts.push_back(sealed);
+    });
+
+    for (int i = 0; i < 8; ++i) {
+        wal.append("actor", "key" + std::to_string(i), std::string(40, 'x'));
+    }
+    REQUIRE(!sealed_counts.empty());
+    for (size_t i = 0; i < sealed_counts.size(); ++i) {
+        CHECK(sealed_counts[i] == i + 1);
+    }
+}
+
+TEST_CASE(tombstones_round_trip_through_encode) {
+    WAL::EntryView entry{7, 1234, "actor", "key", "", WAL::Op::Delete};
+    std::string line;
+    WAL::encode(entry, line);
+    CHECK(line[0] == '-');
+    REQUIRE(line.back() == '\n');
+    line.pop_back();
+
+    WAL::EntryView decoded;
+    REQUIRE(WAL::decode(line, decoded));
+    CHECK(decoded.seq_no == 7u);
+    CHECK(decoded.actor_id == "actor");
+    CHECK(decoded.key == "key");
+    CHECK(decoded.op == WAL::Op::Delete);
+}
+
+TEST_CASE(version_and_expiry_round_trip_through_encode) {
+    WAL::EntryView entry{9, 1234, "actor", "key", "a|b", WAL::Op::Put, 4, 5678};
+    std::string line;
+    WAL::encode(entry, line);
+    line.pop_back();
+
+    WAL::EntryView decoded;
+    REQUIRE(WAL::decode(line, decoded));
+    CHECK(decoded.timestamp == 1234u);
+    CHECK(decoded.version == 4u);
+    CHECK(decoded.expires_at_ms == 5678u);
+    CHECK(decoded.value == "a|b");
+
+    CHECK(decoded.created_at_ms == 1234u); // same as the timestamp, so not written
+
+    entry.created_at_ms = 1000;
+    line.clear();
+    WAL::encode(entry, line);
+    line.pop_back();
+    REQUIRE(WAL::decode(line, decoded));
+    CHECK(decoded.created_at_ms == 1000u);
+    CHECK(decoded.expires_at_ms == 5678u);
+
+    // Lines written before versions were logged still decode, with version 0
+    REQUIRE(WAL::decode("3|1234|actor|key|v", decoded));
+    CHECK(decoded.version == 0u);
+    CHECK(decoded.expires_at_ms == 0u);
+    CHECK(!WAL::decode("3|1234:4|actor|key|v", decoded));
+}
+
+TEST_CASE(entries_are_on_disk_when_append_returns) {
+    TestDir dir("wal-durable");
+    WAL wal(dir.file("wal.log"));
+    uint64_t seq = wal.append("actor", "key", "value");
+
+    // Read through a separate handle while the WAL still has the file open
+    std::ifstream in(dir.file("wal.log"));
+    std::string line;
+    REQUIRE(std::getline(in, line));
+    WAL::EntryView entry;
+    REQUIRE(WAL::decode(line, entry));
+    CHECK(entry.seq_no == seq);
+    CHECK(entry.value == "value");
+    CHECK(wal.committed_seq() == seq);
+}
+
+TEST_CASE(commit_watermark_waits_for_gaps_across_streams) {
+    TestDir dir("wal-watermark");
+    WAL wal(dir.file("wal.log"), 10 * 1024 * 1024, 4);
+    std::string first = "a0";
+    std::string second = "a1";
+    for (int i = 2; wal.stream_for(second) == wal.stream_for(first); ++i) {
+        second = "a" + std::to_string(i);
+    }
+
+    uint64_t seq1 = wal.reserve(first);
+    uint64_t seq2 = wal.reserve(second);
+    REQUIRE(seq2 == seq1 + 1);
+    // The later entry lands first, in its own stream; it is written but not yet committed
+    wal.write_reserved(seq2, second, "k", "v");
+    CHECK(wal.committed_seq() == seq1 - 1);
+    CHECK(!wal.wait_for_commit(seq2, std::chrono::milliseconds(0)));
+
+    wal.write_reserved(seq1, first, "k", "v");
+    CHECK(wal.committed_seq() == seq2);
+    CHECK(wal.wait_for_commit(seq2, std::chrono::milliseconds(0)));
+}
+
+TEST_CASE(empty_manifest_is_rejected) {
+    TestDir dir("wal-manifest");
+    const std::string path = dir.file("wal.log");
+    {
+        WAL wal(path);
+        wal.append("actor", "key", "value");
+        wal.rotate();
+    }
+    // Truncated by a crash: the numbered segment files must not be trusted instead
+    std::ofstream(path + ".manifest", std::ios::trunc).close();
+    bool threw = false;
+    try {
+        WAL wal(path);
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    CHECK(threw);
+}
+
+TEST_CASE(batch_touching_a_failed_stream_takes_no_seqs) {
+    TestDir dir("wal-batch-failed");
+    WAL wal(dir.file("wal.log"), 10 * 1024 * 1024, 2);
+    auto [doomed, healthy] = actors_on_two_streams(wal);
+    {
+        FileSizeLimit limit(256);
+        CHECK(throws([&]() { wal.append(doomed, "k", std::string(512, 'x')); }));
+    }
+
+    const uint64_t last = wal.last_seq();
+    std::vector<WAL::EntryView> batch{{0, 0, healthy, "k", "v"}, {0, 0, doomed, "k", "v"}};
+    CHECK(throws([&]() { wal.append_batch(batch); }));
+    CHECK(wal.last_seq() == last);
+
+    // Streams that are still healthy keep taking batches
+    batch.pop_back();
+    CHECK(wal.append_batch(batch) == last + 1);
+}
+
+TEST_CASE(failed_stream_does_not_hold_back_the_watermark) {
+    TestDir dir("wal-failed-watermark");
+    WAL wal(dir.file("wal.log"), 10 * 1024 * 1024, 2);
+    auto [doomed, healthy] = actors_on_two_streams(wal);
+
+    // Reserved before the failure, stranded is abandoned when its stream dies
+    uint64_t failing = wal.reserve(doomed);
+    uint64_t stranded = wal.reserve(doomed);
+    uint64_t later = wal.reserve(healthy);
+    {
+        FileSizeLimit limit(256);
+        CHECK(throws([&]() { wal.write_reserved(failing, doomed, "k", std::string(512, 'x')); }));
+    }
+    CHECK(throws([&]() { wal.write_reserved(stranded, doomed, "k", "v"); }));
+    CHECK(throws([&]() { wal.reserve(doomed); }));
+
+    wal.write_reserved(later, healthy, "k", "v");
+    CHECK(wal.committed_seq() == later);
+
+    // Later seqs keep committing on the healthy stream
+    uint64_t next = wal.append(healthy, "k", "v2");
+    CHECK(wal.wait_for_commit(next, std::chrono::milliseconds(0)));
+}
+
+TEST_MAIN()
@@ -0,0 +1,58 @@
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include "mem_store.h"
+#include "warm_restart.h"
+#include "check.h"
+#include "test_dir.h"
+
+TEST_CASE(successor_picks_up_writes_logged_during_handoff) {
+    TestDir dir("warm-restart");
+    const std::string socket_path = dir.file("handoff");
+    auto old_wal = std::make_shared<WAL>(dir.file("wal.log"));
+    MemStore old_store(old_wal);
+    old_store.set("actor", "before", "1");
+
+    // The successor opens the log while the predecessor is still appending to it
+    auto new_wal = std::make_shared<WAL>(dir.file("wal.log"));
+    MemStore new_store(new_wal);
+
+    WarmRestart restart(socket_path);
+    std::promise<void> requested;
+    restart.listen([&requested]() { requested.set_value(); });
+
+    auto adopted = std::async(std::launch::async, [&]() {
+        return WarmRestart::adopt(new_store, *new_wal, socket_path, std::chrono::seconds(10));
+    });
+    REQUIRE(requested.get_future().wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+    old_store.set("actor", "during", "2");
+    CHECK(restart.hand_over(old_store, *old_wal));
+    REQUIRE(adopted.get());
+
+    CHECK(new_store.get("actor", "before") == std::optional<std::string>("1"));
+    CHECK(new_store.get("actor", "during") == std::optional<std::string>("2"));
+    CHECK(new_wal->last_seq() == 2u);
+
+    // The old log is closed; the new one carries on the sequence
+    bool rejected = false;
+    try {
+        old_wal->append("actor", "after", "x");
+    } catch (const std::runtime_error&) {
+        rejected = true;
+    }
+    CHECK(rejected);
+    new_store.set("actor", "after", "3");
+    CHECK(new_wal->last_seq() == 3u);
+}
+
+TEST_CASE(adopt_without_predecessor_returns_false) {
+    TestDir dir("warm-restart-none");
+    auto wal = std::make_shared<WAL>(dir.file("wal.log"));
+    MemStore store(wal);
+    CHECK(!WarmRestart::adopt(store, *wal, dir.file("handoff")));
+}
+
+TEST_MAIN()
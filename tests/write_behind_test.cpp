@@ -0,0 +1,75 @@
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include "mem_store.h"
+#include "wal.h"
+#include "write_behind_worker.h"
+#include "check.h"
+#include "test_dir.h"
+
+using namespace std::chrono_literals;
+
+namespace {
+template <typename Pred>
+bool eventually(Pred pred) {
+    for (int i = 0; i < 200; ++i) {
+        if (pred()) return true;
+        std::this_thread::sleep_for(5ms);
+    }
+    return pred();
+}
+}
+
+TEST_CASE(failed_flush_requeues_the_window) {
+    TestDir dir("write-behind-retry");
+    auto wal = std::make_shared<WAL>(dir.file("wal.log"));
+    MemStore store(wal);
+    WriteBehindTuning tuning;
+    tuning.min_interval = 1ms;
+    tuning.max_interval = 20ms;
+    WriteBehindWorker worker(store, *wal, 16, 1, tuning);
+
+    wal->close();
+    worker.enqueue({"actor", "a", "1"});
+    worker.enqueue({"actor", "b", "1"});
+    worker.start();
+    REQUIRE(eventually([&] { return worker.stats().failed_flushes > 0; }));
+
+    // A newer write to a re-queued key replaces it in place
+    worker.enqueue({"actor", "a", "2"});
+    wal->reload();
+    REQUIRE(eventually([&] { return worker.stats().records_written == 2; }));
+    worker.stop();
+    CHECK(worker.stats().records_dropped == 0u);
+
+    std::ifstream in(dir.file("wal.log"));
+    std::string line;
+    std::vector<std::pair<std::string, std::string>> logged;
+    while (std::getline(in, line)) {
+        WAL::EntryView entry;
+        REQUIRE(WAL::decode(line, entry));
+        logged.emplace_back(std::string(entry.key), std::string(entry.value));
+    }
+    REQUIRE(logged.size() == 2u);
+    CHECK(logged[0] == std::make_pair(std::string("a"), std::string("2")));
+    CHECK(logged[1] == std::make_pair(std::string("b"), std::string("1")));
+}
+
+TEST_CASE(stop_counts_records_it_cannot_write) {
+    TestDir dir("write-behind-drop");
+    auto wal = std::make_shared<WAL>(dir.file("wal.log"));
+    MemStore store(wal);
+    WriteBehindWorker worker(store, *wal, 16, 1);
+
+    wal->close();
+    worker.enqueue({"actor", "a", "1"});
+    worker.stop();
+    auto stats = worker.stats();
+    CHECK(stats.failed_flushes == 1u);
+    CHECK(stats.records_dropped == 1u);
+    CHECK(stats.pending == 0u);
+}
+
+TEST_MAIN()
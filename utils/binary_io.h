@@ -0,0 +1,127 @@
+#ifndef BINARY_IO_H_
+#define BINARY_IO_H_
+
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include <cstring>
+#include <array>
+
+/*
+Little helpers for the on-disk formats (snapshots, checkpoints, SST files):
+varints, fixed-width little-endian integers, length-prefixed strings and CRC32.
+Decoders consume from the front of a string_view and return false on truncation.
+*/
+
+namespace binary_io {
+
+inline void put_fixed32(std::string &out, uint32_t v)
+{
+    char buf[4];
+    for (int i = 0; i < 4; ++i) buf[i] = static_cast<char>((v >> (8 * i)) & 0xff);
+    out.append(buf, 4);
+}
+
+inline void put_fixed64(std::string &out, uint64_t v)
+{
+    char buf[8];
+    for (int i = 0; i < 8; ++i) buf[i] = static_cast<char>((v >> (8 * i)) & 0xff);
+    out.append(buf, 8);
+}
+
+inline void put_varint(std::string &out, uint64_t v)
+{
+    while (v >= 0x80) {
+        out.push_back(static_cast<char>(v | 0x80));
+        v >>= 7;
+    }
+    out.push_back(static_cast<char>(v));
+}
+
+inline void put_bytes(std::string &out, std::string_view bytes)
+{
+    put_varint(out, bytes.size());
+    out.append(bytes.data(), bytes.size());
+}
+
+inline uint32_t load_fixed32(const char *p)
+{
+    uint32_t v = 0;
+    for (int i = 0; i < 4; ++i) v |= static_cast<uint32_t>(static_cast<unsigned char>(p[i])) << (8 * i);
+    return v;
+}
+
+inline uint64_t load_fixed64(const char *p)
+{
+    uint64_t v = 0;
+    for (int i = 0; i < 8; ++i) v |= static_cast<uint64_t>(static_cast<unsigned char>(p[i])) << (8 * i);
+    return v;
+}
+
+inline bool get_fixed32(std::string_view &in, uint32_t &v)
+{
+    if (in.size() < 4) return false;
+    v = load_fixed32(in.data());
+    in.remove_prefix(4);
+    return true;
+}
+
+inline bool get_fixed64(std::string_view &in, uint64_t &v)
+{
+    if (in.size() < 8) return false;
+    v = load_fixed64(in.data());
+    in.remove_prefix(8);
+    return true;
+}
+
+inline bool get_varint(std::string_view &in, uint64_t &v)
+{
+    v = 0;
+    for (int shift = 0; shift < 64 && !in.empty(); shift += 7) {
+        auto byte = static_cast<unsigned char>(in.front());
+        in.remove_prefix(1);
+        v |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) return true;
+    }
+    return false;
+}
+
+inline bool get_bytes(std::string_view &in, std::string_view &bytes)
+{
+    uint64_t len;
+    if (!get_varint(in, len) || in.size() < len) return false;
+    bytes = in.substr(0, len);
+    in.remove_prefix(len);
+    return true;
+}
+
+inline uint32_t crc32(const char *data, size_t len, uint32_t crc = 0)
+{
+    static const auto table = [] {
+        std::array<uint32_t, 256> t{};
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; ++k) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            t[i] = c;
+        }
+        return t;
+    }();
+    crc = ~crc;
+    for (size_t i = 0; i < len; ++i) {
+        crc = table[(crc ^ static_cast<unsigned char>(data[i])) & 0xff] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+inline uint32_t crc32(std::string_view data) { return crc32(data.data(), data.size()); }
+
+inline size_t shared_prefix(std::string_view a, std::string_view b)
+{
+    size_t n = 0, limit = a.size() < b.size() ? a.size() : b.size();
+    while (n < limit && a[n] == b[n]) ++n;
+    return n;
+}
+
+} // namespace binary_io
+
+#endif // BINARY_IO_H_
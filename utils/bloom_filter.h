@@ -0,0 +1,89 @@
+#ifndef BLOOM_FILTER_H_
+#define BLOOM_FILTER_H_
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include <cmath>
+
+/*
+Bloom filter over a set of keys, built once and then stored next to the data
+it describes (SST files). The hash is fixed rather than std::hash so filters
+stay valid across builds. The last byte of a filter holds the probe count.
+*/
+
+namespace bloom {
+
+inline uint64_t hash(std::string_view key)
+{
+    uint64_t h = 1469598103934665603ull; // FNV-1a
+    for (unsigned char c : key) {
+        h = (h ^ c) * 1099511628211ull;
+    }
+    h ^= h >> 33; // finalise so nearby keys spread over the whole word
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    return h;
+}
+
+class FilterBuilder
+{
+public:
+    explicit FilterBuilder(size_t bits_per_key = 10) : bits_per_key_(bits_per_key) {}
+
+    void add(std::string_view key) { hashes_.push_back(hash(key)); }
+    size_t size() const { return hashes_.size(); }
+
+    std::string finish() const
+    {
+        size_t probes = static_cast<size_t>(std::round(bits_per_key_ * 0.69)); // ln 2
+        if (probes < 1) probes = 1;
+        if (probes > 30) probes = 30;
+
+        size_t bits = hashes_.size() * bits_per_key_;
+        if (bits < 64) bits = 64;
+        size_t bytes = (bits + 7) / 8;
+        bits = bytes * 8;
+
+        std::string filter(bytes, '\0');
+        for (uint64_t h : hashes_) {
+            uint64_t delta = (h >> 33) | (h << 31);
+            for (size_t i = 0; i < probes; ++i) {
+                uint64_t bit = h % bits;
+                filter[bit / 8] |= static_cast<char>(1 << (bit % 8));
+                h += delta;
+            }
+        }
+        filter.push_back(static_cast<char>(probes));
+        return filter;
+    }
+
+private:
+    size_t bits_per_key_;
+    std::vector<uint64_t> hashes_;
+};
+
+// False means the key is definitely absent; true means it may be present.
+inline bool may_contain(std::string_view filter, std::string_view key)
+{
+    if (filter.size() < 2) {
+        return true;
+    }
+    size_t probes = static_cast<unsigned char>(filter.back());
+    size_t bits = (filter.size() - 1) * 8;
+    uint64_t h = hash(key);
+    uint64_t delta = (h >> 33) | (h << 31);
+    for (size_t i = 0; i < probes; ++i) {
+        uint64_t bit = h % bits;
+        if (!(filter[bit / 8] & (1 << (bit % 8)))) {
+            return false;
+        }
+        h += delta;
+    }
+    return true;
+}
+
+} // namespace bloom
+
+#endif // BLOOM_FILTER_H_
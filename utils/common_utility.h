@@ -1,6 +1,7 @@
 #pragma once
 #include <chrono>
 #include <string>
+#include <functional>
 using namespace std;
 
 inline std::string current_timestamp() {
@@ -10,3 +11,85 @@ inline std::string current_timestamp() {
         
     return std::to_string(ms);
 }
+
+// Stable actor -> partition mapping shared by MemStore shards and WAL streams.
+// With a shard count that is a multiple of the stream count, every WAL stream
+// serves a fixed group of store shards.
+inline size_t partition_for(const std::string& actor_id, size_t partitions) {
+    return partitions > 1 ? std::hash<std::string>{}(actor_id) % partitions : 0;
+}
+
+// Shell-style match of the whole text: '*' any run, '?' any character,
+// '[abc]', '[a-z]' and '[!abc]' character classes, '\' escapes the next one.
+inline bool glob_match(const std::string& pattern, const std::string& text) {
+    size_t p = 0, t = 0;
+    size_t star = std::string::npos, resume = 0; // last '*' and where it resumes in text
+
+    auto match_class = [&pattern](size_t& at, char c) {
+        // at points just past '['; leaves it just past ']'
+        bool negate = at < pattern.size() && (pattern[at] == '!' || pattern[at] == '^');
+        if (negate) ++at;
+        bool found = false;
+        bool first = true;
+        while (at < pattern.size() && (first || pattern[at] != ']')) {
+            char lo = pattern[at++];
+            char hi = lo;
+            if (at + 1 < pattern.size() && pattern[at] == '-' && pattern[at + 1] != ']') {
+                hi = pattern[at + 1];
+                at += 2;
+            }
+            if (lo <= c && c <= hi) found = true;
+            first = false;
+        }
+        if (at < pattern.size()) ++at; // ']'
+        return found != negate;
+    };
+
+    while (t < text.size()) {
+        if (p < pattern.size() && pattern[p] == '*') {
+            star = p++;
+            resume = t;
+            continue;
+        }
+        if (p < pattern.size()) {
+            size_t next = p + 1;
+            bool ok;
+            if (pattern[p] == '?') {
+                ok = true;
+            } else if (pattern[p] == '[') {
+                ok = match_class(next, text[t]);
+            } else if (pattern[p] == '\\' && p + 1 < pattern.size()) {
+                ok = pattern[p + 1] == text[t];
+                next = p + 2;
+            } else {
+                ok = pattern[p] == text[t];
+            }
+            if (ok) {
+                p = next;
+                ++t;
+                continue;
+            }
+        }
+        if (star == std::string::npos) return false;
+        // Let the last '*' swallow one more character and retry
+        p = star + 1;
+        t = ++resume;
+    }
+    while (p < pattern.size() && pattern[p] == '*') ++p;
+    return p == pattern.size();
+}
+
+// Leading part of a glob pattern without wildcards: every match starts with it.
+inline std::string glob_literal_prefix(const std::string& pattern) {
+    std::string prefix;
+    for (size_t i = 0; i < pattern.size(); ++i) {
+        char c = pattern[i];
+        if (c == '*' || c == '?' || c == '[') break;
+        if (c == '\\') {
+            if (++i == pattern.size()) break;
+            c = pattern[i];
+        }
+        prefix += c;
+    }
+    return prefix;
+}
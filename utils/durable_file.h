@@ -0,0 +1,79 @@
+#ifndef DURABLE_FILE_H_
+#define DURABLE_FILE_H_
+
+#include <string>
+#include <stdexcept>
+#include <filesystem>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+/*
+Crash-safe replacement of small metadata files (manifests). The new contents
+go to a temporary file that is synced before it is renamed over the old one,
+and the directory is synced after, so once write_atomically returns the new
+file survives a crash and whatever it supersedes can be deleted.
+*/
+
+namespace durable_file {
+
+inline void sync_fd(int fd, const std::string &path)
+{
+    if (::fsync(fd) != 0) {
+        const std::string error = strerror(errno);
+        ::close(fd);
+        throw std::runtime_error("Failed to sync " + path + ": " + error);
+    }
+}
+
+// Makes renames and removals of the directory's entries durable.
+inline void sync_dir(const std::string &dir)
+{
+    const std::string path = dir.empty() ? "." : dir;
+    int fd = ::open(path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd < 0) {
+        throw std::runtime_error("Failed to open directory " + path + ": " + strerror(errno));
+    }
+    sync_fd(fd, path);
+    ::close(fd);
+}
+
+inline void sync_parent_dir(const std::string &path)
+{
+    sync_dir(std::filesystem::path(path).parent_path().string());
+}
+
+inline void write_atomically(const std::string &path, const std::string &contents)
+{
+    const std::string tmp = path + ".tmp";
+    int fd = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        throw std::runtime_error("Failed to create " + tmp + ": " + strerror(errno));
+    }
+    size_t written = 0;
+    while (written < contents.size()) {
+        ssize_t n = ::write(fd, contents.data() + written, contents.size() - written);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            const std::string error = strerror(errno);
+            ::close(fd);
+            ::unlink(tmp.c_str());
+            throw std::runtime_error("Failed to write " + tmp + ": " + error);
+        }
+        written += static_cast<size_t>(n);
+    }
+    try {
+        sync_fd(fd, tmp);
+    } catch (const std::exception &) {
+        ::unlink(tmp.c_str());
+        throw;
+    }
+    ::close(fd);
+    std::filesystem::rename(tmp, path);
+    sync_parent_dir(path);
+}
+
+} // namespace durable_file
+
+#endif // DURABLE_FILE_H_
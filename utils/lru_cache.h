@@ -0,0 +1,121 @@
+#ifndef LRU_CACHE_H_
+#define LRU_CACHE_H_
+
+#include <list>
+#include <mutex>
+#include <memory>
+#include <atomic>
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <unordered_map>
+#include <functional>
+
+/*
+A size-bounded LRU cache split into independently locked shards. Each entry
+carries a charge (e.g. its size in bytes) and the least recently used entries
+of a shard are evicted once the shard is over its share of the capacity.
+Values are handed out by copy, so shared_ptr values stay alive while in use
+even after eviction.
+*/
+
+template <typename K, typename V, typename Hash = std::hash<K>>
+class LRUCache
+{
+public:
+    explicit LRUCache(size_t capacity, size_t num_shards = 16)
+        : shards_(num_shards ? num_shards : 1)
+    {
+        for (auto &shard : shards_) {
+            shard.capacity = capacity / shards_.size();
+        }
+    }
+
+    LRUCache(LRUCache const &) = delete;
+    LRUCache &operator=(LRUCache const &) = delete;
+
+    bool get(K const &key, V &value)
+    {
+        auto &shard = shard_for(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.index.find(key);
+        if (it == shard.index.end()) {
+            misses_++;
+            return false;
+        }
+        shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+        value = it->second->value;
+        hits_++;
+        return true;
+    }
+
+    void put(K const &key, V value, size_t charge)
+    {
+        auto &shard = shard_for(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.index.find(key);
+        if (it != shard.index.end()) {
+            shard.usage -= it->second->charge;
+            shard.entries.erase(it->second);
+            shard.index.erase(it);
+        }
+        shard.entries.push_front(Entry{key, std::move(value), charge});
+        shard.index[key] = shard.entries.begin();
+        shard.usage += charge;
+
+        while (shard.usage > shard.capacity && shard.entries.size() > 1) {
+            auto &victim = shard.entries.back();
+            shard.usage -= victim.charge;
+            shard.index.erase(victim.key);
+            shard.entries.pop_back();
+        }
+    }
+
+    void erase(K const &key)
+    {
+        auto &shard = shard_for(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.index.find(key);
+        if (it != shard.index.end()) {
+            shard.usage -= it->second->charge;
+            shard.entries.erase(it->second);
+            shard.index.erase(it);
+        }
+    }
+
+    size_t usage() const
+    {
+        size_t total = 0;
+        for (auto &shard : shards_) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            total += shard.usage;
+        }
+        return total;
+    }
+
+    uint64_t hits() const { return hits_.load(); }
+    uint64_t misses() const { return misses_.load(); }
+
+private:
+    struct Entry {
+        K key;
+        V value;
+        size_t charge;
+    };
+
+    struct Shard {
+        mutable std::mutex mutex;
+        std::list<Entry> entries; // most recently used first
+        std::unordered_map<K, typename std::list<Entry>::iterator, Hash> index;
+        size_t usage = 0;
+        size_t capacity = 0;
+    };
+
+    std::vector<Shard> shards_;
+    std::atomic<uint64_t> hits_{0};
+    std::atomic<uint64_t> misses_{0};
+
+    Shard &shard_for(K const &key) { return shards_[Hash{}(key) % shards_.size()]; }
+};
+
+#endif // LRU_CACHE_H_
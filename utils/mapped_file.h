@@ -0,0 +1,129 @@
+#ifndef MAPPED_FILE_H_
+#define MAPPED_FILE_H_
+
+#include <string>
+#include <string_view>
+#include <stdexcept>
+#include <utility>
+#include <cstddef>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/*
+Read-only memory mapping of a file. The mapping can be refreshed when the file
+grows, which lets readers follow an append-only file without copying it.
+*/
+
+class MappedFile
+{
+public:
+    MappedFile() = default;
+
+    explicit MappedFile(const std::string &path)
+    {
+        fd_ = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd_ < 0) {
+            throw std::runtime_error("Failed to open file for mapping: " + path);
+        }
+        remap();
+    }
+
+    ~MappedFile() { reset(); }
+
+    MappedFile(MappedFile &&other) noexcept { swap(other); }
+    MappedFile &operator=(MappedFile &&other) noexcept
+    {
+        if (this != &other) {
+            reset();
+            swap(other);
+        }
+        return *this;
+    }
+
+    MappedFile(MappedFile const &) = delete;
+    MappedFile &operator=(MappedFile const &) = delete;
+
+    // Maps the current length of the file. Returns true if the mapping grew;
+    // views into the previous mapping are invalidated when that happens.
+    bool remap()
+    {
+        struct stat st;
+        if (fd_ < 0 || ::fstat(fd_, &st) != 0) {
+            return false;
+        }
+        size_t new_size = static_cast<size_t>(st.st_size);
+        if (new_size <= size_) {
+            return false;
+        }
+        unmap();
+        void *addr = ::mmap(nullptr, new_size, PROT_READ, MAP_SHARED, fd_, 0);
+        if (addr == MAP_FAILED) {
+            throw std::runtime_error("mmap failed");
+        }
+        data_ = static_cast<const char *>(addr);
+        size_ = new_size;
+        return true;
+    }
+
+    void advise_sequential() const
+    {
+        if (data_) {
+            ::madvise(const_cast<char *>(data_), size_, MADV_SEQUENTIAL);
+        }
+    }
+
+    // For lookups that jump around, so the kernel does not read ahead for nothing.
+    void advise_random() const
+    {
+        if (data_) {
+            ::madvise(const_cast<char *>(data_), size_, MADV_RANDOM);
+        }
+    }
+
+    std::string_view view() const { return {data_, size_}; }
+    const char *data() const { return data_; }
+    size_t size() const { return size_; }
+    bool is_open() const { return fd_ >= 0; }
+    int fd() const { return fd_; }
+
+    // Inode of the mapped file, used to notice that a path now names another file.
+    ino_t inode() const
+    {
+        struct stat st;
+        return (fd_ >= 0 && ::fstat(fd_, &st) == 0) ? st.st_ino : 0;
+    }
+
+private:
+    int fd_ = -1;
+    const char *data_ = nullptr;
+    size_t size_ = 0;
+
+    void unmap()
+    {
+        if (data_) {
+            ::munmap(const_cast<char *>(data_), size_);
+            data_ = nullptr;
+            size_ = 0;
+        }
+    }
+
+    void reset()
+    {
+        unmap();
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+    }
+
+    void swap(MappedFile &other) noexcept
+    {
+        std::swap(fd_, other.fd_);
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+    }
+};
+
+#endif // MAPPED_FILE_H_
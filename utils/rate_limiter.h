@@ -0,0 +1,79 @@
+#ifndef RATE_LIMITER_H_
+#define RATE_LIMITER_H_
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+/*
+Token bucket for background I/O. Callers take tokens before each write and
+sleep when the bucket runs dry, so snapshot and checkpoint writers sharing a
+limiter stay under one combined budget. A rate of 0 disables the limit.
+*/
+
+class RateLimiter
+{
+public:
+    explicit RateLimiter(uint64_t bytes_per_sec, uint64_t burst_bytes = 0)
+        : rate_(bytes_per_sec),
+          burst_(burst_bytes ? burst_bytes : bytes_per_sec / 10),
+          available_(static_cast<double>(burst_)),
+          last_refill_(std::chrono::steady_clock::now())
+    {
+    }
+
+    RateLimiter(RateLimiter const &) = delete;
+    RateLimiter &operator=(RateLimiter const &) = delete;
+
+    // Blocks until the bytes fit in the budget. A request larger than the
+    // burst is let through by going into debt, which later callers pay off.
+    void acquire(uint64_t bytes)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (rate_ == 0) {
+            return;
+        }
+        refill();
+        available_ -= static_cast<double>(bytes);
+        if (available_ >= 0) {
+            return;
+        }
+        auto wait = std::chrono::duration<double>(-available_ / static_cast<double>(rate_));
+        lock.unlock();
+        std::this_thread::sleep_for(wait);
+    }
+
+    void set_rate(uint64_t bytes_per_sec)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        refill();
+        rate_ = bytes_per_sec;
+    }
+
+    uint64_t rate() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return rate_;
+    }
+
+private:
+    mutable std::mutex mutex_;
+    uint64_t rate_;
+    uint64_t burst_;
+    double available_;
+    std::chrono::steady_clock::time_point last_refill_;
+
+    void refill()
+    {
+        auto now = std::chrono::steady_clock::now();
+        std::chrono::duration<double> elapsed = now - last_refill_;
+        last_refill_ = now;
+        available_ += elapsed.count() * static_cast<double>(rate_);
+        if (available_ > static_cast<double>(burst_)) {
+            available_ = static_cast<double>(burst_);
+        }
+    }
+};
+
+#endif // RATE_LIMITER_H_
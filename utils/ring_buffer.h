@@ -0,0 +1,207 @@
+#ifndef RING_BUFFER_H_
+#define RING_BUFFER_H_
+
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <condition_variable>
+
+/*
+A fixed-capacity ring buffer between one producer side that must never wait
+and one consumer. Push never blocks: when the ring is full, the overflow
+policy decides what gives.
+
+  DropOldest  the oldest element is discarded to make room.
+  Conflate    while there is room every element is buffered, as with
+              DropOldest. Only on overflow does an element whose key is
+              already buffered replace the latest copy in place, so the
+              consumer still gets the newest value of that key; a full ring
+              with a new key falls back to DropOldest.
+  Disconnect  the push is refused and the ring is marked overflowed. The
+              consumer is expected to give up and let the client resume.
+
+Counters are atomics so they can be read without the lock for metrics.
+*/
+
+template <typename T>
+class RingBuffer
+{
+public:
+    enum class OverflowPolicy { DropOldest, Conflate, Disconnect };
+    using KeyExtractor = std::function<std::string(const T&)>;
+
+    RingBuffer(size_t capacity, OverflowPolicy policy, KeyExtractor key_of = nullptr)
+        : slots_(capacity ? capacity : 1), policy_(policy), key_of_(std::move(key_of))
+    {
+        if (policy_ == OverflowPolicy::Conflate && !key_of_) {
+            policy_ = OverflowPolicy::DropOldest; // nothing to conflate on
+        }
+    }
+
+    RingBuffer(const RingBuffer&) = delete;
+    RingBuffer& operator=(const RingBuffer&) = delete;
+
+    // Returns false if the value was not buffered: the ring is closed or,
+    // under Disconnect, overflowed.
+    bool Push(T value)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mu_);
+            if (closed_ || overflowed_) {
+                return false;
+            }
+            if (policy_ == OverflowPolicy::Conflate) {
+                std::string key = key_of_(value);
+                auto it = index_.find(key);
+                if (size_ == slots_.size()) {
+                    if (it != index_.end()) {
+                        slots_[it->second % slots_.size()] = std::move(value);
+                        conflated_++;
+                        return true; // already signalled when first buffered
+                    }
+                    DropFrontLocked();
+                }
+                index_[std::move(key)] = tail_pos_; // latest copy of the key
+            } else if (size_ == slots_.size()) {
+                if (policy_ == OverflowPolicy::Disconnect) {
+                    overflowed_ = true;
+                    data_cond_.notify_all();
+                    return false;
+                }
+                DropFrontLocked();
+            }
+            slots_[tail_pos_++ % slots_.size()] = std::move(value);
+            size_++;
+        }
+        data_cond_.notify_one();
+        return true;
+    }
+
+    // Waits up to timeout for data, then moves up to max_count elements into
+    // out (after clearing it). Returns the number taken; 0 on timeout, close
+    // or overflow.
+    size_t WaitAndPopBatch(std::vector<T>& out, size_t max_count, std::chrono::milliseconds timeout)
+    {
+        out.clear();
+        std::unique_lock<std::mutex> lock(mu_);
+        if (!data_cond_.wait_for(lock, timeout, [this]() { return closed_ || overflowed_ || size_ > 0; })) {
+            return 0;
+        }
+        if (overflowed_) {
+            return 0;
+        }
+        while (size_ > 0 && out.size() < max_count) {
+            out.push_back(PopFrontLocked());
+        }
+        return out.size();
+    }
+
+    // Waits until max_count elements are buffered or the deadline passes,
+    // then appends up to max_count of them to out. Returns the number taken.
+    size_t FillBatch(std::vector<T>& out, size_t max_count, std::chrono::steady_clock::time_point deadline)
+    {
+        std::unique_lock<std::mutex> lock(mu_);
+        data_cond_.wait_until(lock, deadline,
+                              [this, max_count]() { return closed_ || overflowed_ || size_ >= max_count; });
+        if (overflowed_) {
+            return 0;
+        }
+        size_t taken = 0;
+        while (size_ > 0 && taken < max_count) {
+            out.push_back(PopFrontLocked());
+            taken++;
+        }
+        return taken;
+    }
+
+    bool WaitAndPop(T& value, std::chrono::milliseconds timeout)
+    {
+        std::vector<T> out;
+        if (WaitAndPopBatch(out, 1, timeout) == 0) {
+            return false;
+        }
+        value = std::move(out.front());
+        return true;
+    }
+
+    void Close()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mu_);
+            closed_ = true;
+        }
+        data_cond_.notify_all();
+    }
+
+    bool Overflowed() const
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        return overflowed_;
+    }
+
+    // Positions count every element ever buffered. Everything buffered before
+    // a call to TailPosition() has left the ring, taken or dropped, once
+    // HeadPosition() reaches the value it returned.
+    uint64_t HeadPosition() const
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        return head_pos_;
+    }
+
+    uint64_t TailPosition() const
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        return tail_pos_;
+    }
+
+    size_t Capacity() const { return slots_.size(); }
+    size_t Size() const { return size_.load(); }
+    uint64_t GetDroppedCount() const { return dropped_.load(); }
+    uint64_t GetConflatedCount() const { return conflated_.load(); }
+
+private:
+    T PopFrontLocked()
+    {
+        T value = std::move(slots_[head_pos_ % slots_.size()]);
+        slots_[head_pos_ % slots_.size()] = T();
+        if (policy_ == OverflowPolicy::Conflate) {
+            auto it = index_.find(key_of_(value));
+            if (it != index_.end() && it->second == head_pos_) {
+                index_.erase(it);
+            }
+        }
+        head_pos_++;
+        size_--;
+        return value;
+    }
+
+    void DropFrontLocked()
+    {
+        PopFrontLocked();
+        dropped_++;
+    }
+
+    mutable std::mutex mu_;
+    std::condition_variable data_cond_;
+    std::vector<T> slots_;
+    OverflowPolicy policy_;
+    KeyExtractor key_of_;
+
+    // Positions count every element ever buffered, so slot = position % capacity
+    uint64_t head_pos_ = 0;
+    uint64_t tail_pos_ = 0;
+    std::atomic<size_t> size_{0};
+    std::unordered_map<std::string, uint64_t> index_; // Conflate: key -> position of its latest copy
+    bool closed_ = false;
+    bool overflowed_ = false;
+
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<uint64_t> conflated_{0};
+};
+
+#endif // RING_BUFFER_H_
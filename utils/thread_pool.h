@@ -14,11 +14,14 @@ public:
     ~ThreadPool();
     
     void Submit(Callable task);
+    // Low-priority work (compaction, checkpoints): only picked up when no regular task is queued.
+    void SubmitBackground(Callable task);
     void Stop();
     
 private:
     std::atomic<bool> done;
     BoundedThreadsafeQueue<Callable> work_queue;
+    BoundedThreadsafeQueue<Callable> background_queue;
     std::vector<std::thread> threads;
     std::atomic<size_t> active_workers{0};
     
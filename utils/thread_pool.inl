@@ -24,6 +24,13 @@ void ThreadPool<Iterable>::Submit(Callable task) {
     }
 }
 
+template <typename Iterable>
+void ThreadPool<Iterable>::SubmitBackground(Callable task) {
+    if (!done) {
+        background_queue.Push(std::move(task));
+    }
+}
+
 template <typename Iterable>
 void ThreadPool<Iterable>::Stop() {
     done = true;
@@ -38,7 +45,7 @@ template <typename Iterable>
 void ThreadPool<Iterable>::WorkerThread() {
     while (!done) {
         Callable task;
-        if (work_queue.TryPop(task)) {
+        if (work_queue.TryPop(task) || background_queue.TryPop(task)) {
             ++active_workers;
             try {
                 task();
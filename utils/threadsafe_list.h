@@ -127,6 +127,7 @@ public:
                 current->next = std::move(old_next->next);
                 next_lk.unlock();
                 size_--;
+                continue; // current keeps its lock and now points past the removed node
             }
             lk.unlock();
             current = next;
@@ -1,5 +1,22 @@
 #include "threadsafe_queue.h"
 
+template <typename T>
+T BoundedThreadsafeQueue<T>::PopFrontLocked()
+{
+    T value = std::move(queue_.front());
+    queue_.pop_front();
+    size_--;
+    if (key_of_) {
+        // Leave the entry if a newer element with this key is still queued
+        auto it = index_.find(key_of_(value));
+        if (it != index_.end() && it->second == head_pos_) {
+            index_.erase(it);
+        }
+    }
+    head_pos_++;
+    return value;
+}
+
 template <typename T>
 std::shared_ptr<T> BoundedThreadsafeQueue<T>::WaitAndPop()
 {
@@ -8,9 +25,7 @@ std::shared_ptr<T> BoundedThreadsafeQueue<T>::WaitAndPop()
     if (stopped_ && queue_.empty()) {
         return std::shared_ptr<T>();
     }
-    std::shared_ptr<T> res(std::make_shared<T>(std::move(queue_.front())));
-    queue_.pop_front();
-    size_--;
+    std::shared_ptr<T> res(std::make_shared<T>(PopFrontLocked()));
     space_cond.notify_one();
     return res;
 }
@@ -30,9 +45,7 @@ bool BoundedThreadsafeQueue<T>::WaitAndPop(T &value, std::chrono::milliseconds t
     if (stopped_ && queue_.empty()) {
         return false;
     }
-    value = std::move(queue_.front());
-    queue_.pop_front();
-    size_--;
+    value = PopFrontLocked();
     space_cond.notify_one();
     return true;
 }
@@ -44,9 +57,7 @@ bool BoundedThreadsafeQueue<T>::TryPop(T &value)
     if (queue_.empty()) {
         return false;
     }
-    value = std::move(queue_.front());
-    queue_.pop_front();
-    size_--;
+    value = PopFrontLocked();
     space_cond.notify_one();
 
     return true;
@@ -59,9 +70,7 @@ std::shared_ptr<T> BoundedThreadsafeQueue<T>::TryPop()
     if (queue_.empty()) {
         return std::shared_ptr<T>();
     }
-    std::shared_ptr<T> res(std::make_shared<T>(std::move(queue_.front())));
-    queue_.pop_front();
-    size_--;
+    std::shared_ptr<T> res(std::make_shared<T>(PopFrontLocked()));
     space_cond.notify_one();
     return res;
 }
@@ -74,6 +83,10 @@ void BoundedThreadsafeQueue<T>::Push(T new_value)
     if (stopped_) {
         return;
     }
+    std::optional<std::string> key;
+    if (key_of_) {
+        key = key_of_(new_value);
+    }
     // Handle different overflow policies
     if (queue_.size() >= max_size_) {
         switch (policy_) {
@@ -84,22 +97,30 @@ void BoundedThreadsafeQueue<T>::Push(T new_value)
             case OverflowPolicy::DropNewest:
                 return; // Simply discard the new value
             case OverflowPolicy::DropOldest:
-                queue_.pop_front(); // Remove oldest to make space
-                size_--;    
+                PopFrontLocked(); // Remove oldest to make space
                 break;
             case OverflowPolicy::Compact:
-                // For compacting, need to define equality or key logic at T level.
-                // Example: if T has .key field, we could scan & replace.
-                while (queue_.size() >= max_size_) {
-                    queue_.pop_front();
-                    size_--;
+                if (key) {
+                    auto it = index_.find(*key);
+                    if (it != index_.end()) {
+                        // The queued element is superseded: take its slot, keeping its place in line
+                        queue_[it->second - head_pos_] = std::move(new_value);
+                        compacted_++;
+                        return;
+                    }
                 }
+                // Nothing to fold it into: wait for space rather than lose it
+                space_cond.wait(lock, [this](){ return stopped_ || queue_.size() < max_size_; });
+                if (stopped_) return;
                 break;
         }
     }
     
     queue_.push_back(std::move(new_value));
     size_++;
+    if (key) {
+        index_[*key] = head_pos_ + queue_.size() - 1;
+    }
     data_cond.notify_one();
 }
 
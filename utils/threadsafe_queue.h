@@ -9,16 +9,25 @@
 #include <atomic>
 #include <deque>
 #include <limits>
+#include <chrono>
+#include <string>
+#include <optional>
+#include <functional>
+#include <unordered_map>
 
 // BoundedThreadsafeQueue<T>
 // - Single mutex to avoid deadlocks.
 // - Supports OverflowPolicy: Block, DropNewest, DropOldest, Compact.
 // - Provides Push, WaitAndPop(with timeout), TryPopNonBlocking, Size, Empty.
+// - Compact needs a key extractor: a push into a full queue replaces the queued
+//   element with the same key in place, found through an index in O(1). With
+//   no such element it blocks like Block, so nothing is lost.
 template <typename T>
 class BoundedThreadsafeQueue
 {
 public:
     enum class OverflowPolicy { Block, DropNewest, DropOldest, Compact };
+    using KeyExtractor = std::function<std::string(const T&)>;
 
 private:
     mutable std::mutex mu_;
@@ -31,11 +40,23 @@ private:
     std::deque<T> queue_;
     std::atomic<bool> stopped_{false};
 
+    // Compact: key -> position of its newest queued element, counted from
+    // the first element ever pushed so the index survives pops
+    KeyExtractor key_of_;
+    std::unordered_map<std::string, uint64_t> index_;
+    uint64_t head_pos_ = 0;
+    std::atomic<uint64_t> compacted_{0};
+
+    T PopFrontLocked();
+
 public:
     explicit BoundedThreadsafeQueue(uint32_t max_size = std::numeric_limits<uint32_t>::max(),
                            OverflowPolicy policy = OverflowPolicy::Block)
         : max_size_(max_size), policy_(policy) {}
 
+    BoundedThreadsafeQueue(uint32_t max_size, KeyExtractor key_of)
+        : max_size_(max_size), policy_(OverflowPolicy::Compact), key_of_(std::move(key_of)) {}
+
     BoundedThreadsafeQueue(const BoundedThreadsafeQueue&) = delete;
     BoundedThreadsafeQueue& operator=(const BoundedThreadsafeQueue&) = delete;
 
@@ -46,6 +67,8 @@ public:
     void Push(T new_value);
     bool Empty() const;
     uint32_t GetSize() const;
+    // Pushes absorbed by replacing a queued element with the same key
+    uint64_t GetCompactedCount() const { return compacted_.load(); }
 
     void Stop() {
         stopped_.store(true);